@@ -25,6 +25,8 @@
 
 #include <avr-libcpp/pgmspace>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace picolibrary::ROM {
 
@@ -33,11 +35,34 @@ namespace picolibrary::ROM {
  */
 #define PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
 
+#if defined( __AVR_HAVE_ELPM__ )
+/**
+ * \brief picolibrary::ROM::String uses 24-bit (far) ROM addresses.
+ */
+#define PICOLIBRARY_ROM_STRING_IS_FAR
+#endif // defined( __AVR_HAVE_ELPM__ )
+
 /**
  * \brief A pointer to a null-terminated string stored in ROM.
+ *
+ * On devices that have more than 64 KiB of ROM (devices that support the ELPM
+ * instruction), the pointer is a 24-bit (far) ROM address that is read using the ELPM
+ * instruction (RAMPZ is set automatically), so strings can be placed anywhere in ROM.
  */
 class String {
   public:
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    /**
+     * \brief ROM address.
+     */
+    using Address = std::uint32_t;
+#else  // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    /**
+     * \brief ROM address.
+     */
+    using Address = char const *;
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+
     /**
      * \brief Constructor.
      */
@@ -48,12 +73,27 @@ class String {
      *
      * To create a string literal stored in ROM, use PICOLIBRARY_ROM_STRING().
      *
-     * \param[in] string The underlying ROM character pointer.
+     * \param[in] address The ROM address of the pointed to character.
      */
-    constexpr String( char const * string ) noexcept : m_string{ string }
+    constexpr String( Address address ) noexcept : m_address{ address }
     {
     }
 
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    /**
+     * \brief Constructor.
+     *
+     * \pre string is located in the first 64 KiB of ROM (e.g. string was created using
+     *      PSTR())
+     *
+     * \param[in] string The underlying 16-bit (near) ROM character pointer.
+     */
+    String( char const * string ) noexcept :
+        m_address{ static_cast<Address>( reinterpret_cast<std::uintptr_t>( string ) ) }
+    {
+    }
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+
     /**
      * \brief Constructor.
      *
@@ -91,6 +131,36 @@ class String {
      */
     constexpr auto operator=( String const & expression ) noexcept -> String & = default;
 
+    /**
+     * \brief Get the ROM address of the pointed to character.
+     *
+     * On devices that support 24-bit (far) ROM addresses, the address is a 24-bit (far)
+     * ROM address (e.g. for use with pgm_read_byte_far() or memcpy_PF()).
+     *
+     * \return The ROM address of the pointed to character.
+     */
+    constexpr auto address() const noexcept -> Address
+    {
+        return m_address;
+    }
+
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    /**
+     * \brief Get the underlying 16-bit (near) ROM character pointer.
+     *
+     * To get the ROM address of a character located anywhere in ROM, use
+     * picolibrary::ROM::String::address().
+     *
+     * \pre the pointed to character is located in the first 64 KiB of ROM (e.g. the
+     *      string was created using PSTR())
+     *
+     * \return The underlying 16-bit (near) ROM character pointer.
+     */
+    auto string() const noexcept -> char const *
+    {
+        return reinterpret_cast<char const *>( static_cast<std::uintptr_t>( m_address ) );
+    }
+#else  // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
     /**
      * \brief Get the underlying ROM character pointer.
      *
@@ -98,8 +168,9 @@ class String {
      */
     constexpr auto string() const noexcept -> char const *
     {
-        return m_string;
+        return m_address;
     }
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
 
     /**
      * \brief Access the pointed to character.
@@ -108,7 +179,7 @@ class String {
      */
     auto operator*() const noexcept -> char
     {
-        return pgm_read_byte( m_string );
+        return read( m_address );
     }
 
     /**
@@ -120,7 +191,7 @@ class String {
      */
     auto operator[]( std::ptrdiff_t offset ) const noexcept -> char
     {
-        return pgm_read_byte( m_string + offset );
+        return read( m_address + offset );
     }
 
     /**
@@ -130,7 +201,7 @@ class String {
      */
     constexpr auto operator++() noexcept -> String &
     {
-        ++m_string;
+        ++m_address;
 
         return *this;
     }
@@ -142,7 +213,7 @@ class String {
      */
     constexpr auto operator--() noexcept -> String &
     {
-        --m_string;
+        --m_address;
 
         return *this;
     }
@@ -154,9 +225,9 @@ class String {
      */
     constexpr auto operator++( int ) noexcept -> String
     {
-        auto string = m_string;
+        auto string = *this;
 
-        ++m_string;
+        ++m_address;
 
         return string;
     }
@@ -168,9 +239,9 @@ class String {
      */
     constexpr auto operator--( int ) noexcept -> String
     {
-        auto string = m_string;
+        auto string = *this;
 
-        --m_string;
+        --m_address;
 
         return string;
     }
@@ -184,7 +255,7 @@ class String {
      */
     constexpr auto operator+( std::ptrdiff_t n ) const noexcept -> String
     {
-        return m_string + n;
+        return m_address + n;
     }
 
     /**
@@ -196,7 +267,7 @@ class String {
      */
     constexpr auto operator-( std::ptrdiff_t n ) const noexcept -> String
     {
-        return m_string - n;
+        return m_address - n;
     }
 
     /**
@@ -208,7 +279,7 @@ class String {
      */
     constexpr auto operator+=( std::ptrdiff_t n ) noexcept -> String &
     {
-        m_string += n;
+        m_address += n;
 
         return *this;
     }
@@ -222,16 +293,32 @@ class String {
      */
     constexpr auto operator-=( std::ptrdiff_t n ) noexcept -> String &
     {
-        m_string -= n;
+        m_address -= n;
 
         return *this;
     }
 
   private:
     /**
-     * \brief The underlying ROM character pointer.
+     * \brief The ROM address of the pointed to character.
      */
-    char const * m_string{};
+    Address m_address{};
+
+    /**
+     * \brief Read a character from ROM.
+     *
+     * \param[in] address The ROM address of the character to read.
+     *
+     * \return The character.
+     */
+    static auto read( Address address ) noexcept -> char
+    {
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+        return pgm_read_byte_far( address );
+#else  // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+        return pgm_read_byte( address );
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    }
 };
 
 /**
@@ -247,7 +334,7 @@ class String {
  */
 constexpr auto operator==( String lhs, String rhs ) noexcept -> bool
 {
-    return lhs.string() == rhs.string();
+    return lhs.address() == rhs.address();
 }
 
 /**
@@ -279,7 +366,7 @@ constexpr auto operator!=( String lhs, String rhs ) noexcept -> bool
  */
 constexpr auto operator<( String lhs, String rhs ) noexcept -> bool
 {
-    return lhs.string() < rhs.string();
+    return lhs.address() < rhs.address();
 }
 
 /**
@@ -341,7 +428,7 @@ constexpr auto operator>=( String lhs, String rhs ) noexcept -> bool
  */
 constexpr auto operator+( std::ptrdiff_t n, String string ) noexcept -> String
 {
-    return string.string() + n;
+    return string + n;
 }
 
 /**
@@ -355,7 +442,7 @@ constexpr auto operator+( std::ptrdiff_t n, String string ) noexcept -> String
  */
 constexpr auto operator-( std::ptrdiff_t n, String string ) noexcept -> String
 {
-    return string.string() - n;
+    return string - n;
 }
 
 /**
@@ -370,19 +457,746 @@ constexpr auto operator-( std::ptrdiff_t n, String string ) noexcept -> String
  */
 constexpr auto operator-( String lhs, String rhs ) noexcept -> std::ptrdiff_t
 {
-    return lhs.string() - rhs.string();
+    return lhs.address() - rhs.address();
+}
+
+/**
+ * \brief Sequential ROM reader.
+ *
+ * Each read uses the LPM (ELPM on devices that support 24-bit (far) ROM addresses)
+ * instruction's Z pointer post-increment mode, so reading consecutive ROM bytes in a loop
+ * does not require the Z pointer to be reloaded for each byte.
+ */
+class Reader {
+  public:
+    Reader() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] position The ROM location to start reading from.
+     */
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    constexpr Reader( String position ) noexcept :
+        m_z{ static_cast<std::uint16_t>( position.address() ) },
+        m_rampz{ static_cast<std::uint8_t>( position.address() >> 16 ) }
+    {
+    }
+#else  // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    constexpr Reader( String position ) noexcept : m_z{ position.address() }
+    {
+    }
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Reader( Reader && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Reader( Reader const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Reader() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Reader && expression ) noexcept -> Reader & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Reader const & expression ) noexcept -> Reader & = default;
+
+    /**
+     * \brief Get the ROM location the next read will read from.
+     *
+     * \return The ROM location the next read will read from.
+     */
+    constexpr auto position() const noexcept -> String
+    {
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+        return ( static_cast<String::Address>( m_rampz ) << 16 ) | m_z;
+#else  // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+        return m_z;
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    }
+
+    /**
+     * \brief Read a character and advance to the next character.
+     *
+     * \return The character.
+     */
+    auto read() noexcept -> char
+    {
+        char character;
+
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+        // RAMPZ is reloaded for each read since it may have been changed between reads
+        // (e.g. by an interrupt or another reader), and read back after each read since
+        // ELPM's Z pointer post-increment carries into RAMPZ
+        asm volatile(
+            "out %[rampz_address], %[rampz]\n\t"
+            "elpm %[character], Z+\n\t"
+            "in %[rampz], %[rampz_address]"
+            : [character] "=r"( character ), [rampz] "+r"( m_rampz ), [z] "+z"( m_z )
+            : [rampz_address] "I"( RAMPZ_IO_ADDRESS ) );
+#else  // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+        asm volatile( "lpm %[character], Z+" : [character] "=r"( character ), [z] "+z"( m_z ) );
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+
+        return character;
+    }
+
+  private:
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    /**
+     * \brief RAMPZ I/O address.
+     */
+    static constexpr auto RAMPZ_IO_ADDRESS = 0x3B;
+
+    /**
+     * \brief The low 16 bits of the ROM address of the next character (Z).
+     */
+    std::uint16_t m_z;
+
+    /**
+     * \brief The high 8 bits of the ROM address of the next character (RAMPZ).
+     */
+    std::uint8_t m_rampz;
+#else  // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+    /**
+     * \brief The ROM address of the next character (Z).
+     */
+    char const * m_z;
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+};
+
+/**
+ * \brief Get the length of a null-terminated string stored in ROM.
+ *
+ * \param[in] string The null-terminated string stored in ROM.
+ *
+ * \return The length of the string (not including the null-terminator).
+ */
+inline auto length( String string ) noexcept -> std::size_t
+{
+    auto reader = Reader{ string };
+
+    auto length = std::size_t{};
+    while ( reader.read() ) { ++length; } // while
+
+    return length;
+}
+
+/**
+ * \brief Copy a block of ROM to RAM.
+ *
+ * \param[in] begin The beginning of the block of ROM to copy.
+ * \param[in] end The end of the block of ROM to copy.
+ * \param[out] destination The beginning of the RAM to copy the block of ROM to.
+ *
+ * \return The end of the RAM the block of ROM was copied to.
+ */
+inline auto copy( String begin, String end, char * destination ) noexcept -> char *
+{
+    auto reader = Reader{ begin };
+
+    for ( auto n = end - begin; n; --n ) { *destination++ = reader.read(); } // for
+
+    return destination;
+}
+
+/**
+ * \brief Compare a null-terminated string stored in ROM to a null-terminated string stored
+ *        in RAM.
+ *
+ * \param[in] lhs The null-terminated string stored in ROM.
+ * \param[in] rhs The null-terminated string stored in RAM.
+ *
+ * \return A negative value if lhs is lexicographically less than rhs.
+ * \return 0 if lhs is equal to rhs.
+ * \return A positive value if lhs is lexicographically greater than rhs.
+ */
+inline auto compare( String lhs, char const * rhs ) noexcept -> int
+{
+    auto reader = Reader{ lhs };
+
+    for ( ;; ) {
+        auto const character = static_cast<unsigned char>( reader.read() );
+        auto const other     = static_cast<unsigned char>( *rhs++ );
+
+        if ( character != other or not character ) {
+            return character - other;
+        } // if
+    }     // for
+}
+
+/**
+ * \brief Apply a functor to each character in a block of ROM.
+ *
+ * \tparam Functor A unary functor that takes a char.
+ *
+ * \param[in] begin The beginning of the block of ROM.
+ * \param[in] end The end of the block of ROM.
+ * \param[in] functor The functor to apply to each character in the block of ROM.
+ *
+ * \return The functor.
+ */
+template<typename Functor>
+auto for_each( String begin, String end, Functor functor ) noexcept( noexcept( functor( char{} ) ) )
+    -> Functor
+{
+    auto reader = Reader{ begin };
+
+    for ( auto n = end - begin; n; --n ) { functor( reader.read() ); } // for
+
+    return functor;
+}
+
+/**
+ * \brief Apply a functor to each character in a null-terminated string stored in ROM.
+ *
+ * \tparam Functor A unary functor that takes a char.
+ *
+ * \param[in] string The null-terminated string stored in ROM.
+ * \param[in] functor The functor to apply to each character in the string (not including
+ *            the null-terminator).
+ *
+ * \return The functor.
+ */
+template<typename Functor>
+auto for_each( String string, Functor functor ) noexcept( noexcept( functor( char{} ) ) ) -> Functor
+{
+    auto reader = Reader{ string };
+
+    while ( auto const character = reader.read() ) { functor( character ); } // while
+
+    return functor;
+}
+
+/**
+ * \brief Read an object stored in ROM.
+ *
+ * The object's bytes are read using consecutive LPM Z pointer post-increment reads (see
+ * picolibrary::ROM::Reader), so multi-byte objects (e.g. 16-bit and 32-bit integers) are
+ * read without reloading the Z pointer for each byte.
+ *
+ * \tparam T The type of object to read.
+ *
+ * \param[in] object The object stored in ROM.
+ *
+ * \return A copy of the object.
+ */
+template<typename T>
+auto read( T const * object ) noexcept -> T
+{
+    static_assert( std::is_trivially_copyable_v<T> and std::is_default_constructible_v<T> );
+
+    auto reader = Reader{ reinterpret_cast<char const *>( object ) };
+
+    auto value       = T{};
+    auto destination = reinterpret_cast<char *>( &value );
+    for ( auto n = sizeof( T ); n; --n ) { *destination++ = reader.read(); } // for
+
+    return value;
+}
+
+/**
+ * \brief A pointer to an object stored in ROM.
+ *
+ * \tparam T The type of the pointed to object.
+ */
+template<typename T>
+class Pointer {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Pointer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] object The pointed to object (must be stored in the first 64 KiB of ROM,
+     *            e.g. using PROGMEM).
+     */
+    constexpr explicit Pointer( T const * object ) noexcept : m_object{ object }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Pointer( Pointer && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Pointer( Pointer const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Pointer() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Pointer && expression ) noexcept -> Pointer & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Pointer const & expression ) noexcept -> Pointer & = default;
+
+    /**
+     * \brief Get the underlying ROM object pointer.
+     *
+     * \return The underlying ROM object pointer.
+     */
+    constexpr auto pointer() const noexcept -> T const *
+    {
+        return m_object;
+    }
+
+    /**
+     * \brief Access the pointed to object.
+     *
+     * \return A copy of the pointed to object.
+     */
+    auto operator*() const noexcept -> T
+    {
+        return read( m_object );
+    }
+
+  private:
+    /**
+     * \brief The underlying ROM object pointer.
+     */
+    T const * m_object{};
+};
+
+/**
+ * \brief Equality operator.
+ *
+ * \relatedalso picolibrary::ROM::Pointer
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is equal to rhs.
+ * \return false if lhs is not equal to rhs.
+ */
+template<typename T>
+constexpr auto operator==( Pointer<T> lhs, Pointer<T> rhs ) noexcept -> bool
+{
+    return lhs.pointer() == rhs.pointer();
+}
+
+/**
+ * \brief Inequality operator.
+ *
+ * \relatedalso picolibrary::ROM::Pointer
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is not equal to rhs.
+ * \return false if lhs is equal to rhs.
+ */
+template<typename T>
+constexpr auto operator!=( Pointer<T> lhs, Pointer<T> rhs ) noexcept -> bool
+{
+    return not( lhs == rhs );
+}
+
+/**
+ * \brief A fixed size array stored in ROM.
+ *
+ * To create an array stored in ROM whose elements are computed at compile time, use
+ * picolibrary::ROM::generate_array().
+ *
+ * \tparam T The array element type.
+ * \tparam N The number of elements in the array.
+ */
+template<typename T, std::size_t N>
+class Array {
+  public:
+    /**
+     * \brief The array element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief Array size type.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Array iterator.
+     */
+    class Iterator {
+      public:
+        /**
+         * \brief Constructor.
+         */
+        constexpr Iterator() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] element The pointed to element.
+         */
+        constexpr Iterator( T const * element ) noexcept : m_element{ element }
+        {
+        }
+
+        /**
+         * \brief Access the pointed to element.
+         *
+         * \return A copy of the pointed to element.
+         */
+        auto operator*() const noexcept -> T
+        {
+            return read( m_element );
+        }
+
+        /**
+         * \brief Access the element at the specified offset from the pointed to element.
+         *
+         * \param[in] offset The offset of the element to access.
+         *
+         * \return A copy of the element at the specified offset from the pointed to
+         *         element.
+         */
+        auto operator[]( std::ptrdiff_t offset ) const noexcept -> T
+        {
+            return read( m_element + offset );
+        }
+
+        /**
+         * \brief Advance the iterator to the next element.
+         *
+         * \return The advanced iterator.
+         */
+        constexpr auto operator++() noexcept -> Iterator &
+        {
+            ++m_element;
+
+            return *this;
+        }
+
+        /**
+         * \brief Retreat the iterator to the previous element.
+         *
+         * \return The retreated iterator.
+         */
+        constexpr auto operator--() noexcept -> Iterator &
+        {
+            --m_element;
+
+            return *this;
+        }
+
+        /**
+         * \brief Advance a copy of the iterator n elements.
+         *
+         * \param[in] n The number of elements to advance the copy of the iterator.
+         *
+         * \return A copy of the iterator that has been advanced n elements.
+         */
+        constexpr auto operator+( std::ptrdiff_t n ) const noexcept -> Iterator
+        {
+            return m_element + n;
+        }
+
+        /**
+         * \brief Retreat a copy of the iterator n elements.
+         *
+         * \param[in] n The number of elements to retreat the copy of the iterator.
+         *
+         * \return A copy of the iterator that has been retreated n elements.
+         */
+        constexpr auto operator-( std::ptrdiff_t n ) const noexcept -> Iterator
+        {
+            return m_element - n;
+        }
+
+        /**
+         * \brief Get the distance between two iterators.
+         *
+         * \param[in] rhs The right hand side of the operation.
+         *
+         * \return The distance between the two iterators.
+         */
+        constexpr auto operator-( Iterator rhs ) const noexcept -> std::ptrdiff_t
+        {
+            return m_element - rhs.m_element;
+        }
+
+        /**
+         * \brief Equality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators point to the same element.
+         * \return false if the iterators do not point to the same element.
+         */
+        constexpr auto operator==( Iterator rhs ) const noexcept -> bool
+        {
+            return m_element == rhs.m_element;
+        }
+
+        /**
+         * \brief Inequality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators do not point to the same element.
+         * \return false if the iterators point to the same element.
+         */
+        constexpr auto operator!=( Iterator rhs ) const noexcept -> bool
+        {
+            return not( *this == rhs );
+        }
+
+      private:
+        /**
+         * \brief The pointed to element.
+         */
+        T const * m_element{};
+    };
+
+    Array() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] elements The array's elements (must be stored in the first 64 KiB of ROM,
+     *            e.g. using PROGMEM).
+     */
+    constexpr Array( T const ( &elements )[ N ] ) noexcept : m_elements{ elements }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Array( Array && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Array( Array const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Array() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Array && expression ) noexcept -> Array & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Array const & expression ) noexcept -> Array & = default;
+
+    /**
+     * \brief Get the number of elements in the array.
+     *
+     * \return The number of elements in the array.
+     */
+    static constexpr auto size() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get a pointer to the array's elements.
+     *
+     * \return A pointer to the array's elements.
+     */
+    constexpr auto data() const noexcept -> T const *
+    {
+        return m_elements;
+    }
+
+    /**
+     * \brief Access an element.
+     *
+     * \param[in] index The index of the element to access.
+     *
+     * \return A copy of the element.
+     */
+    auto operator[]( Size index ) const noexcept -> T
+    {
+        return read( m_elements + index );
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the array.
+     *
+     * \return An iterator to the first element of the array.
+     */
+    constexpr auto begin() const noexcept -> Iterator
+    {
+        return m_elements;
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the array.
+     *
+     * \return An iterator to the element following the last element of the array.
+     */
+    constexpr auto end() const noexcept -> Iterator
+    {
+        return m_elements + N;
+    }
+
+  private:
+    /**
+     * \brief The array's elements.
+     */
+    T const * m_elements;
+};
+
+/**
+ * \brief Compile time generated array elements stored in ROM.
+ *
+ * \tparam T The array element type.
+ * \tparam N The number of elements in the array.
+ * \tparam GENERATOR The constexpr function that computes the element at a given index.
+ */
+template<typename T, std::size_t N, T ( *GENERATOR )( std::size_t )>
+class Generated_Array_Elements {
+  public:
+    /**
+     * \brief The elements.
+     */
+    struct Elements {
+        /**
+         * \brief The elements.
+         */
+        T elements[ N ];
+    };
+
+    /**
+     * \brief Compute the elements.
+     *
+     * \return The elements.
+     */
+    static constexpr auto generate() noexcept -> Elements
+    {
+        auto elements = Elements{};
+
+        for ( auto i = std::size_t{}; i < N; ++i ) { elements.elements[ i ] = GENERATOR( i ); } // for
+
+        return elements;
+    }
+
+    /**
+     * \brief The elements.
+     */
+    static constexpr Elements ELEMENTS PROGMEM = generate();
+
+    Generated_Array_Elements() = delete;
+
+    Generated_Array_Elements( Generated_Array_Elements && ) = delete;
+
+    Generated_Array_Elements( Generated_Array_Elements const & ) = delete;
+
+    ~Generated_Array_Elements() = delete;
+
+    auto operator=( Generated_Array_Elements && ) = delete;
+
+    auto operator=( Generated_Array_Elements const & ) = delete;
+};
+
+/**
+ * \brief Create an array stored in ROM whose elements are computed at compile time.
+ *
+ * \relatedalso picolibrary::ROM::Array
+ *
+ * \tparam T The array element type.
+ * \tparam N The number of elements in the array.
+ * \tparam GENERATOR The constexpr function that computes the element at a given index.
+ *
+ * \return The array stored in ROM.
+ */
+template<typename T, std::size_t N, T ( *GENERATOR )( std::size_t )>
+constexpr auto generate_array() noexcept -> Array<T, N>
+{
+    return Generated_Array_Elements<T, N, GENERATOR>::ELEMENTS.elements;
 }
 
 /**
  * \brief Create a string literal stored in ROM.
  *
+ * On devices that support 24-bit (far) ROM addresses, the string literal is placed in the
+ * .progmemx section, which the linker places after the program's code, so that it does
+ * not occupy the first 64 KiB of ROM.
+ *
  * \relatedalso picolibrary::ROM::String
  *
  * \param[in] string The string literal to store in ROM.
  *
  * \return A pointer to the string literal stored in ROM.
  */
+#if defined( PICOLIBRARY_ROM_STRING_IS_FAR )
+#define PICOLIBRARY_ROM_STRING( string )                                            \
+    ( __extension__( {                                                              \
+        static char const picolibrary_rom_string[] __attribute__( (                 \
+            __section__( ".progmemx.data.picolibrary_rom_string" ) ) ) = ( string ); \
+        ::picolibrary::ROM::String{ pgm_get_far_address( picolibrary_rom_string ) }; \
+    } ) )
+#else // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
 #define PICOLIBRARY_ROM_STRING( string ) ( ::picolibrary::ROM::String{ PSTR( string ) } )
+#endif // defined( PICOLIBRARY_ROM_STRING_IS_FAR )
 
 } // namespace picolibrary::ROM
 
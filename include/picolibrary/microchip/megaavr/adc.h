@@ -0,0 +1,1461 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::ADC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_ADC_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_ADC_H
+
+#include <cstdint>
+
+#include "picolibrary/adc.h"
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/peripheral/adc.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc16.h"
+#include "picolibrary/microchip/megaavr/power.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Microchip megaAVR ADC facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::ADC {
+
+/**
+ * \brief Maximum ADC clock frequency (Hz) at which the ADC provides full (10-bit)
+ *        resolution.
+ */
+constexpr auto ADC_CLOCK_FREQUENCY_MAX = std::uint32_t{ 200'000 };
+
+/**
+ * \brief ADC voltage reference.
+ */
+enum class ADC_Voltage_Reference : std::uint8_t {
+    AREF = Peripheral::ADC::ADMUX::REFS_AREF, ///< AREF.
+    AVCC = Peripheral::ADC::ADMUX::REFS_AVCC, ///< AVCC.
+#if defined( __AVR_ATmega328P__ )
+    INTERNAL_1V1 = Peripheral::ADC::ADMUX::REFS_INTERNAL_11, ///< Internal 1.1 V.
+#elif defined( __AVR_ATmega2560__ )
+    INTERNAL_1V1  = Peripheral::ADC::ADMUX::REFS_INTERNAL_10, ///< Internal 1.1 V.
+    INTERNAL_2V56 = Peripheral::ADC::ADMUX::REFS_INTERNAL_11, ///< Internal 2.56 V.
+#endif // defined( __AVR_ATmega2560__ )
+};
+
+/**
+ * \brief ADC clock prescaler.
+ */
+enum class ADC_Clock_Prescaler : std::uint8_t {
+    _2   = Peripheral::ADC::ADCSRA::ADPS_2,   ///< CLK/2.
+    _4   = Peripheral::ADC::ADCSRA::ADPS_4,   ///< CLK/4.
+    _8   = Peripheral::ADC::ADCSRA::ADPS_8,   ///< CLK/8.
+    _16  = Peripheral::ADC::ADCSRA::ADPS_16,  ///< CLK/16.
+    _32  = Peripheral::ADC::ADCSRA::ADPS_32,  ///< CLK/32.
+    _64  = Peripheral::ADC::ADCSRA::ADPS_64,  ///< CLK/64.
+    _128 = Peripheral::ADC::ADCSRA::ADPS_128, ///< CLK/128.
+};
+
+/**
+ * \brief Get the ADC clock prescaler that provides the fastest ADC clock that does not
+ *        exceed picolibrary::Microchip::megaAVR::ADC::ADC_CLOCK_FREQUENCY_MAX.
+ *
+ * \param[in] f_cpu The CPU clock frequency (Hz).
+ *
+ * \return The ADC clock prescaler that provides the fastest ADC clock that does not
+ *         exceed picolibrary::Microchip::megaAVR::ADC::ADC_CLOCK_FREQUENCY_MAX.
+ */
+constexpr auto maximum_resolution_adc_clock_prescaler( std::uint32_t f_cpu ) noexcept -> ADC_Clock_Prescaler
+{
+    for ( auto adps = std::uint_fast8_t{ 1 }; adps < 7; ++adps ) {
+        if ( ( f_cpu >> adps ) <= ADC_CLOCK_FREQUENCY_MAX ) {
+            return static_cast<ADC_Clock_Prescaler>( adps << Peripheral::ADC::ADCSRA::Bit::ADPS );
+        } // if
+    }     // for
+
+    return ADC_Clock_Prescaler::_128;
+}
+
+/**
+ * \brief ADC input ADCSRB register MUX5 field offset.
+ */
+constexpr auto ADC_INPUT_ADCSRB_MUX5_OFFSET = std::uint_fast8_t{ 2 };
+
+/**
+ * \brief ADC input.
+ */
+enum class ADC_Input : std::uint8_t {
+    ADC0 = 0b00000 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC0.
+    ADC1 = 0b00001 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC1.
+    ADC2 = 0b00010 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC2.
+    ADC3 = 0b00011 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC3.
+    ADC4 = 0b00100 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC4.
+    ADC5 = 0b00101 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC5.
+    ADC6 = 0b00110 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC6.
+    ADC7 = 0b00111 << Peripheral::ADC::ADMUX::Bit::MUX, ///< ADC7.
+#if defined( __AVR_ATmega328P__ )
+    TEMPERATURE_SENSOR = 0b01000 << Peripheral::ADC::ADMUX::Bit::MUX, ///< Temperature sensor.
+    BANDGAP            = 0b01110 << Peripheral::ADC::ADMUX::Bit::MUX, ///< 1.1 V bandgap.
+    GND                = 0b01111 << Peripheral::ADC::ADMUX::Bit::MUX, ///< GND.
+#elif defined( __AVR_ATmega2560__ )
+    ADC8 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+           | ( 0b00000 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC8.
+    ADC9 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+           | ( 0b00001 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC9.
+    ADC10 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+            | ( 0b00010 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC10.
+    ADC11 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+            | ( 0b00011 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC11.
+    ADC12 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+            | ( 0b00100 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC12.
+    ADC13 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+            | ( 0b00101 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC13.
+    ADC14 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+            | ( 0b00110 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC14.
+    ADC15 = ( Peripheral::ADC::ADCSRB::Mask::MUX5 << ADC_INPUT_ADCSRB_MUX5_OFFSET )
+            | ( 0b00111 << Peripheral::ADC::ADMUX::Bit::MUX ), ///< ADC15.
+    BANDGAP = 0b11110 << Peripheral::ADC::ADMUX::Bit::MUX, ///< 1.1 V bandgap.
+    GND     = 0b11111 << Peripheral::ADC::ADMUX::Bit::MUX, ///< GND.
+#endif // defined( __AVR_ATmega2560__ )
+};
+
+/**
+ * \brief ADC sample.
+ */
+using Sample = ::picolibrary::ADC::Sample<std::uint_fast16_t, 0, 1023>;
+
+/**
+ * \brief ADC input selection and clock configuration.
+ *
+ * Computes the ADMUX, ADCSRB, and ADCSRA register values that select an input and
+ * configure the ADC clock once (at construction) so that the converters only have to
+ * write them.
+ */
+class Input_Configuration {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Input_Configuration() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc_voltage_reference The desired ADC voltage reference.
+     * \param[in] adc_input The desired ADC input.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler.
+     */
+    constexpr Input_Configuration(
+        ADC_Voltage_Reference adc_voltage_reference,
+        ADC_Input             adc_input,
+        ADC_Clock_Prescaler   adc_clock_prescaler ) noexcept :
+        m_admux{ static_cast<std::uint8_t>(
+            to_underlying( adc_voltage_reference )
+            | ( to_underlying( adc_input ) & Peripheral::ADC::ADMUX::Mask::MUX ) ) },
+        m_adcsrb{ static_cast<std::uint8_t>(
+            ( to_underlying( adc_input ) >> ADC_INPUT_ADCSRB_MUX5_OFFSET )
+            & Peripheral::ADC::ADCSRB::Mask::MUX5 ) },
+        m_adcsra{ static_cast<std::uint8_t>(
+            Peripheral::ADC::ADCSRA::Mask::ADEN | to_underlying( adc_clock_prescaler ) ) },
+        m_input{ adc_input }
+    {
+    }
+
+    /**
+     * \brief Get the ADMUX register value.
+     *
+     * \return The ADMUX register value.
+     */
+    constexpr auto admux() const noexcept -> std::uint8_t
+    {
+        return m_admux;
+    }
+
+    /**
+     * \brief Get the ADCSRB register value (trigger source free running).
+     *
+     * \return The ADCSRB register value.
+     */
+    constexpr auto adcsrb() const noexcept -> std::uint8_t
+    {
+        return m_adcsrb;
+    }
+
+    /**
+     * \brief Get the ADCSRA register value (ADC enabled, auto triggering and
+     *        interrupts disabled).
+     *
+     * \return The ADCSRA register value.
+     */
+    constexpr auto adcsra() const noexcept -> std::uint8_t
+    {
+        return m_adcsra;
+    }
+
+    /**
+     * \brief Select the input.
+     *
+     * \param[in] adc The ADC to select the input on.
+     */
+    void select( Peripheral::ADC & adc ) const noexcept
+    {
+        adc.admux  = m_admux;
+        adc.adcsrb = ( adc.adcsrb & ~Peripheral::ADC::ADCSRB::Mask::MUX5 ) | m_adcsrb;
+    }
+
+    /**
+     * \brief Disable the input's digital input buffer (if the input is an external
+     *        input).
+     *
+     * \param[in] adc The ADC the input is associated with.
+     */
+    void disable_digital_input_buffer( Peripheral::ADC & adc ) const noexcept
+    {
+        auto const input = to_underlying( m_input );
+
+        if ( input > to_underlying( ADC_Input::ADC7 ) ) {
+#if defined( __AVR_ATmega2560__ )
+            if ( m_adcsrb and ( input & Peripheral::ADC::ADMUX::Mask::MUX ) <= 0b00111 ) {
+                adc.didr2 |= 1 << ( input & Peripheral::ADC::ADMUX::Mask::MUX );
+            } // if
+#endif // defined( __AVR_ATmega2560__ )
+
+            return;
+        } // if
+
+        adc.didr0 |= 1 << input;
+    }
+
+  private:
+    /**
+     * \brief The ADMUX register value.
+     */
+    std::uint8_t m_admux{};
+
+    /**
+     * \brief The ADCSRB register MUX5 field value.
+     */
+    std::uint8_t m_adcsrb{};
+
+    /**
+     * \brief The ADCSRA register value.
+     */
+    std::uint8_t m_adcsra{};
+
+    /**
+     * \brief The input.
+     */
+    ADC_Input m_input{};
+};
+
+/**
+ * \brief Blocking, single sample converter.
+ *
+ * The converter selects its input before each conversion so multiple converters can
+ * share an ADC as long as they are not used concurrently.
+ */
+class Blocking_Single_Sample_Converter {
+  public:
+    /**
+     * \brief Sample.
+     */
+    using Sample = ::picolibrary::Microchip::megaAVR::ADC::Sample;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Blocking_Single_Sample_Converter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC to be used by the converter.
+     * \param[in] adc_voltage_reference The desired ADC voltage reference.
+     * \param[in] adc_input The desired ADC input.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler.
+     */
+    Blocking_Single_Sample_Converter(
+        Peripheral::ADC &     adc,
+        ADC_Voltage_Reference adc_voltage_reference,
+        ADC_Input             adc_input,
+        ADC_Clock_Prescaler adc_clock_prescaler = maximum_resolution_adc_clock_prescaler( F_CPU ) ) noexcept :
+        m_adc{ &adc },
+        m_configuration{ adc_voltage_reference, adc_input, adc_clock_prescaler }
+    {
+        Power::acquire( adc );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Blocking_Single_Sample_Converter( Blocking_Single_Sample_Converter && source ) noexcept :
+        m_adc{ source.m_adc },
+        m_configuration{ source.m_configuration }
+    {
+        source.m_adc = nullptr;
+    }
+
+    Blocking_Single_Sample_Converter( Blocking_Single_Sample_Converter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Blocking_Single_Sample_Converter() noexcept
+    {
+        disable();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Blocking_Single_Sample_Converter && expression ) noexcept
+        -> Blocking_Single_Sample_Converter &
+    {
+        if ( &expression != this ) {
+            disable();
+
+            m_adc           = expression.m_adc;
+            m_configuration = expression.m_configuration;
+
+            expression.m_adc = nullptr;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Blocking_Single_Sample_Converter const & ) = delete;
+
+    /**
+     * \brief Initialize the converter's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_adc->adcsra = m_configuration.adcsra();
+
+        m_configuration.disable_digital_input_buffer( *m_adc );
+    }
+
+    /**
+     * \brief Get a sample.
+     *
+     * \return The sample.
+     */
+    auto sample() noexcept -> Sample
+    {
+        m_configuration.select( *m_adc );
+
+        m_adc->adcsra = m_configuration.adcsra() | Peripheral::ADC::ADCSRA::Mask::ADSC;
+
+        while ( m_adc->adcsra & Peripheral::ADC::ADCSRA::Mask::ADSC ) {} // while
+
+        return Sample{ BYPASS_PRECONDITION_EXPECTATION_CHECKS, m_adc->adc };
+    }
+
+  private:
+    /**
+     * \brief The ADC used by the converter.
+     */
+    Peripheral::ADC * m_adc{};
+
+    /**
+     * \brief The converter's input selection and clock configuration.
+     */
+    Input_Configuration m_configuration{};
+
+    /**
+     * \brief Disable the converter.
+     */
+    constexpr void disable() noexcept
+    {
+        if ( m_adc ) {
+            m_adc->adcsra = 0;
+
+            Power::release( *m_adc );
+        } // if
+    }
+};
+
+/**
+ * \brief Interrupt driven, free running, buffered converter.
+ *
+ * Once started, the ADC converts continuously and
+ * picolibrary::Microchip::megaAVR::ADC::Buffered_Free_Running_Converter::handle_conversion_complete_interrupt()
+ * (which must be called from the ADC conversion complete interrupt's ISR) pushes each
+ * sample into a single producer, single consumer ring buffer. The buffer indices are
+ * 8-bit so neither side needs a critical section. Samples that arrive while the buffer
+ * is full are dropped and counted.
+ *
+ * \tparam BUFFER_SIZE The maximum number of samples the buffer can hold (must be a power
+ *         of two no larger than 128).
+ */
+template<std::uint_fast8_t BUFFER_SIZE>
+class Buffered_Free_Running_Converter {
+  public:
+    static_assert( BUFFER_SIZE >= 2 and BUFFER_SIZE <= 128 );
+    static_assert( ( BUFFER_SIZE & ( BUFFER_SIZE - 1 ) ) == 0 );
+
+    /**
+     * \brief Sample.
+     */
+    using Sample = ::picolibrary::Microchip::megaAVR::ADC::Sample;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC to be used by the converter.
+     * \param[in] adc_voltage_reference The desired ADC voltage reference.
+     * \param[in] adc_input The desired ADC input.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler.
+     */
+    Buffered_Free_Running_Converter(
+        Peripheral::ADC &     adc,
+        ADC_Voltage_Reference adc_voltage_reference,
+        ADC_Input             adc_input,
+        ADC_Clock_Prescaler adc_clock_prescaler = maximum_resolution_adc_clock_prescaler( F_CPU ) ) noexcept :
+        m_adc{ &adc },
+        m_configuration{ adc_voltage_reference, adc_input, adc_clock_prescaler }
+    {
+        Power::acquire( adc );
+    }
+
+    Buffered_Free_Running_Converter( Buffered_Free_Running_Converter && ) = delete;
+
+    Buffered_Free_Running_Converter( Buffered_Free_Running_Converter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Buffered_Free_Running_Converter() noexcept
+    {
+        m_adc->adcsra = 0;
+
+        Power::release( *m_adc );
+    }
+
+    auto operator=( Buffered_Free_Running_Converter && ) = delete;
+
+    auto operator=( Buffered_Free_Running_Converter const & ) = delete;
+
+    /**
+     * \brief Initialize the converter's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_adc->adcsra = m_configuration.adcsra();
+        m_adc->adcsrb = m_configuration.adcsrb() | Peripheral::ADC::ADCSRB::ADTS_FREE_RUNNING;
+        m_adc->admux  = m_configuration.admux();
+
+        m_configuration.disable_digital_input_buffer( *m_adc );
+    }
+
+    /**
+     * \brief Start free running conversion.
+     */
+    void start() noexcept
+    {
+        m_adc->adcsra = m_configuration.adcsra() | Peripheral::ADC::ADCSRA::Mask::ADSC
+                        | Peripheral::ADC::ADCSRA::Mask::ADATE | Peripheral::ADC::ADCSRA::Mask::ADIF
+                        | Peripheral::ADC::ADCSRA::Mask::ADIE;
+    }
+
+    /**
+     * \brief Stop free running conversion.
+     *
+     * \attention A conversion that is in progress when free running conversion is stopped
+     *            will complete, but its sample will not be buffered.
+     */
+    void stop() noexcept
+    {
+        m_adc->adcsra = m_configuration.adcsra();
+    }
+
+    /**
+     * \brief Check if the buffer is empty.
+     *
+     * \return true if the buffer is empty.
+     * \return false if the buffer is not empty.
+     */
+    auto is_empty() const noexcept -> bool
+    {
+        return m_head == m_tail;
+    }
+
+    /**
+     * \brief Get the oldest buffered sample.
+     *
+     * \pre the buffer is not empty
+     *
+     * \return The oldest buffered sample.
+     */
+    auto sample() noexcept -> Sample
+    {
+        PICOLIBRARY_EXPECT( not is_empty(), Generic_Error::WOULD_UNDERFLOW );
+
+        auto const tail = m_tail;
+
+        auto const sample = Sample{ BYPASS_PRECONDITION_EXPECTATION_CHECKS,
+                                    m_buffer[ tail & INDEX_MASK ] };
+
+        m_tail = static_cast<std::uint8_t>( tail + 1 );
+
+        return sample;
+    }
+
+    /**
+     * \brief Get the number of samples that have been dropped because the buffer was
+     *        full (saturates at 255).
+     *
+     * \return The number of samples that have been dropped because the buffer was full.
+     */
+    auto dropped_samples() const noexcept -> std::uint_fast8_t
+    {
+        return m_dropped_samples;
+    }
+
+    /**
+     * \brief Clear the dropped sample count.
+     */
+    void clear_dropped_samples() noexcept
+    {
+        m_dropped_samples = 0;
+    }
+
+    /**
+     * \brief Handle a conversion complete interrupt.
+     *
+     * \attention This function must be called from the ADC conversion complete
+     *            interrupt's ISR.
+     */
+    void handle_conversion_complete_interrupt() noexcept
+    {
+        std::uint16_t const value = m_adc->adc;
+
+        auto const head = m_head;
+
+        if ( static_cast<std::uint8_t>( head - m_tail ) == BUFFER_SIZE ) {
+            if ( m_dropped_samples != 0xFF ) {
+                m_dropped_samples = m_dropped_samples + 1;
+            } // if
+
+            return;
+        } // if
+
+        m_buffer[ head & INDEX_MASK ] = value;
+
+        m_head = static_cast<std::uint8_t>( head + 1 );
+    }
+
+  private:
+    /**
+     * \brief Buffer index mask.
+     */
+    static constexpr auto INDEX_MASK = std::uint8_t{ BUFFER_SIZE - 1 };
+
+    /**
+     * \brief The ADC used by the converter.
+     */
+    Peripheral::ADC * m_adc;
+
+    /**
+     * \brief The converter's input selection and clock configuration.
+     */
+    Input_Configuration m_configuration;
+
+    /**
+     * \brief The sample buffer.
+     */
+    std::uint16_t volatile m_buffer[ BUFFER_SIZE ]{};
+
+    /**
+     * \brief The buffer's head (write) index (free running, only written by the ISR).
+     */
+    std::uint8_t volatile m_head{};
+
+    /**
+     * \brief The buffer's tail (read) index (free running, only written outside the
+     *        ISR).
+     */
+    std::uint8_t volatile m_tail{};
+
+    /**
+     * \brief The number of samples that have been dropped because the buffer was full.
+     */
+    std::uint8_t volatile m_dropped_samples{};
+};
+
+/**
+ * \brief Number of ADC clock half cycles an auto triggered conversion takes (13.5 ADC
+ *        clock cycles).
+ */
+constexpr auto AUTO_TRIGGERED_CONVERSION_ADC_CLOCK_HALF_CYCLES = std::uint_fast8_t{ 27 };
+
+/**
+ * \brief Get the ADC clock prescaler that provides the highest resolution while still
+ *        allowing auto triggered conversions to keep up with a sample rate.
+ *
+ * The returned prescaler never provides an ADC clock faster than needed, and never
+ * provides an ADC clock slower than the clock provided by
+ * picolibrary::Microchip::megaAVR::ADC::maximum_resolution_adc_clock_prescaler().
+ *
+ * \param[in] f_cpu The CPU clock frequency (Hz).
+ * \param[in] sample_rate The sample rate (Hz).
+ *
+ * \return The ADC clock prescaler that provides the highest resolution while still
+ *         allowing auto triggered conversions to keep up with the sample rate.
+ */
+constexpr auto auto_triggered_adc_clock_prescaler( std::uint32_t f_cpu, std::uint32_t sample_rate ) noexcept
+    -> ADC_Clock_Prescaler
+{
+    for ( auto adps = static_cast<std::uint_fast8_t>(
+              to_underlying( maximum_resolution_adc_clock_prescaler( f_cpu ) ) >> Peripheral::ADC::ADCSRA::Bit::ADPS );
+          adps > 1;
+          --adps ) {
+        if ( ( f_cpu >> adps ) * 2 >= sample_rate * AUTO_TRIGGERED_CONVERSION_ADC_CLOCK_HALF_CYCLES ) {
+            return static_cast<ADC_Clock_Prescaler>( adps << Peripheral::ADC::ADCSRA::Bit::ADPS );
+        } // if
+    }     // for
+
+    return ADC_Clock_Prescaler::_2;
+}
+
+/**
+ * \brief TC1 event used to trigger conversions.
+ */
+enum class TC1_Trigger_Event : std::uint8_t {
+    COMPARE_MATCH_B = Peripheral::ADC::ADCSRB::ADTS_TC1_COMPARE_MATCH_B, ///< Compare match B (CTC mode, OCR1A is TOP).
+    OVERFLOW = Peripheral::ADC::ADCSRB::ADTS_TC1_OVERFLOW, ///< Overflow (fast PWM mode, ICR1 is TOP).
+};
+
+/**
+ * \brief TC1 based sample clock.
+ *
+ * The sample clock runs TC1 with a period of one sample period so that the selected TC1
+ * event triggers conversions at the sample rate without any software involvement. The
+ * TC1 clock source and TOP value are selected from F_CPU and the requested sample rate
+ * (the fastest clock source that can provide the sample period is used to minimize
+ * rounding error). The TC1 output compare pins are not used.
+ */
+class TC1_Sample_Clock {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] tc1 TC1.
+     * \param[in] tifr1 TC1's TIFR register.
+     * \param[in] tc1_trigger_event The TC1 event used to trigger conversions.
+     * \param[in] sample_rate The desired sample rate (Hz).
+     *
+     * \pre F_CPU / 65536 / 1024 < sample_rate <= F_CPU / 2
+     */
+    TC1_Sample_Clock(
+        Peripheral::TC16 &       tc1,
+        Peripheral::TC16::TIFR & tifr1,
+        TC1_Trigger_Event        tc1_trigger_event,
+        std::uint32_t            sample_rate ) noexcept :
+        m_tc1{ &tc1 },
+        m_tifr1{ &tifr1 },
+        m_tc1_trigger_event{ tc1_trigger_event }
+    {
+        Power::acquire( tc1 );
+
+        configure_period( sample_rate );
+    }
+
+    TC1_Sample_Clock( TC1_Sample_Clock && ) = delete;
+
+    TC1_Sample_Clock( TC1_Sample_Clock const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~TC1_Sample_Clock() noexcept
+    {
+        m_tc1->tccrb = 0;
+        m_tc1->tccra = 0;
+
+        Power::release( *m_tc1 );
+    }
+
+    auto operator=( TC1_Sample_Clock && ) = delete;
+
+    auto operator=( TC1_Sample_Clock const & ) = delete;
+
+    /**
+     * \brief Get the TC1 event used to trigger conversions.
+     *
+     * \return The TC1 event used to trigger conversions.
+     */
+    constexpr auto trigger_event() const noexcept -> TC1_Trigger_Event
+    {
+        return m_tc1_trigger_event;
+    }
+
+    /**
+     * \brief Get the sample rate (Hz) the sample clock provides.
+     *
+     * \return The sample rate (Hz) the sample clock provides.
+     */
+    constexpr auto sample_rate() const noexcept -> std::uint32_t
+    {
+        return ( F_CPU >> m_prescaler_exponent ) / ( std::uint32_t{ m_top } + 1 );
+    }
+
+    /**
+     * \brief Initialize the sample clock's hardware.
+     *
+     * \attention The sample clock is stopped after initialization.
+     */
+    void initialize() noexcept
+    {
+        m_tc1->tccrb = 0;
+        m_tc1->tccra = tccra_wgm();
+
+        if ( m_tc1_trigger_event == TC1_Trigger_Event::COMPARE_MATCH_B ) {
+            m_tc1->ocra = m_top;
+            m_tc1->ocrb = m_top;
+        } else {
+            m_tc1->icr = m_top;
+        } // else
+
+        m_tc1->tccrb = tccrb_wgm();
+    }
+
+    /**
+     * \brief Start the sample clock.
+     */
+    void start() noexcept
+    {
+        m_tc1->tcnt = 0;
+
+        acknowledge_trigger();
+
+        m_tc1->tccrb = tccrb_wgm() | m_cs;
+    }
+
+    /**
+     * \brief Stop the sample clock.
+     */
+    void stop() noexcept
+    {
+        m_tc1->tccrb = tccrb_wgm();
+    }
+
+    /**
+     * \brief Clear the TC1 event's flag so that the next TC1 event triggers a
+     *        conversion.
+     *
+     * \attention Since the TC1 event's interrupt is not used, this function must be
+     *            called after each triggered conversion completes (the ADC only starts
+     *            a conversion on a rising edge of the event's flag).
+     */
+    void acknowledge_trigger() noexcept
+    {
+        *m_tifr1 = m_tc1_trigger_event == TC1_Trigger_Event::COMPARE_MATCH_B
+                       ? Peripheral::TC16::TIFR::Mask::OCFB
+                       : Peripheral::TC16::TIFR::Mask::TOV;
+    }
+
+  private:
+    /**
+     * \brief TC1.
+     */
+    Peripheral::TC16 * m_tc1;
+
+    /**
+     * \brief TC1's TIFR register.
+     */
+    Peripheral::TC16::TIFR * m_tifr1;
+
+    /**
+     * \brief The TC1 event used to trigger conversions.
+     */
+    TC1_Trigger_Event m_tc1_trigger_event;
+
+    /**
+     * \brief The TC1 clock source (TCCRB register CS field value).
+     */
+    std::uint8_t m_cs{};
+
+    /**
+     * \brief The TC1 clock source's prescaler (log2).
+     */
+    std::uint8_t m_prescaler_exponent{};
+
+    /**
+     * \brief The TC1 TOP value.
+     */
+    std::uint16_t m_top{};
+
+    /**
+     * \brief Select the TC1 clock source and TOP value that provide a sample rate.
+     *
+     * \param[in] sample_rate The desired sample rate (Hz).
+     */
+    void configure_period( std::uint32_t sample_rate ) noexcept
+    {
+        PICOLIBRARY_EXPECT( sample_rate and sample_rate <= F_CPU / 2, Generic_Error::INVALID_ARGUMENT );
+
+        constexpr std::uint8_t prescaler_exponents[] = { 0, 3, 6, 8, 10 };
+
+        auto const ticks = F_CPU / sample_rate;
+
+        for ( auto i = std::uint_fast8_t{}; i < sizeof( prescaler_exponents ); ++i ) {
+            if ( ( ticks >> prescaler_exponents[ i ] ) <= 0x1'0000 ) {
+                m_cs                 = static_cast<std::uint8_t>( ( i + 1 ) << Peripheral::TC16::TCCRB::Bit::CS );
+                m_prescaler_exponent = prescaler_exponents[ i ];
+                m_top = static_cast<std::uint16_t>( ( ticks >> prescaler_exponents[ i ] ) - 1 );
+
+                return;
+            } // if
+        }     // for
+
+        PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::INVALID_ARGUMENT );
+    }
+
+    /**
+     * \brief Get the TCCRA register WGM field value for the TC1 event.
+     *
+     * \return The TCCRA register WGM field value for the TC1 event.
+     */
+    constexpr auto tccra_wgm() const noexcept -> std::uint8_t
+    {
+        return m_tc1_trigger_event == TC1_Trigger_Event::COMPARE_MATCH_B
+                   ? 0b00 << Peripheral::TC16::TCCRA::Bit::WGM
+                   : 0b10 << Peripheral::TC16::TCCRA::Bit::WGM;
+    }
+
+    /**
+     * \brief Get the TCCRB register WGM field value for the TC1 event.
+     *
+     * \return The TCCRB register WGM field value for the TC1 event.
+     */
+    constexpr auto tccrb_wgm() const noexcept -> std::uint8_t
+    {
+        return m_tc1_trigger_event == TC1_Trigger_Event::COMPARE_MATCH_B
+                   ? 0b01 << Peripheral::TC16::TCCRB::Bit::WGM
+                   : 0b11 << Peripheral::TC16::TCCRB::Bit::WGM;
+    }
+};
+
+/**
+ * \brief Timer triggered, double buffered, block converter.
+ *
+ * Conversions are auto triggered by a picolibrary::Microchip::megaAVR::ADC::TC1_Sample_Clock
+ * so sample timing has no software jitter.
+ * picolibrary::Microchip::megaAVR::ADC::Timer_Triggered_Block_Converter::handle_conversion_complete_interrupt()
+ * (which must be called from the ADC conversion complete interrupt's ISR) stores each
+ * sample in one of two (ping-pong) blocks. When a block is full it is handed to the
+ * application and the ISR continues filling the other block. If the application has
+ * not released the previous block by the time the other block fills, the newly filled
+ * block is dropped (and refilled) and the drop is counted.
+ *
+ * \tparam BLOCK_SIZE The number of samples in a block.
+ */
+template<std::uint_fast8_t BLOCK_SIZE>
+class Timer_Triggered_Block_Converter {
+  public:
+    static_assert( BLOCK_SIZE > 0 );
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC to be used by the converter.
+     * \param[in] sample_clock The sample clock used to trigger conversions.
+     * \param[in] adc_voltage_reference The desired ADC voltage reference.
+     * \param[in] adc_input The desired ADC input.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler.
+     */
+    Timer_Triggered_Block_Converter(
+        Peripheral::ADC &     adc,
+        TC1_Sample_Clock &    sample_clock,
+        ADC_Voltage_Reference adc_voltage_reference,
+        ADC_Input             adc_input,
+        ADC_Clock_Prescaler   adc_clock_prescaler ) noexcept :
+        m_adc{ &adc },
+        m_sample_clock{ &sample_clock },
+        m_configuration{ adc_voltage_reference, adc_input, adc_clock_prescaler }
+    {
+        Power::acquire( adc );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * The ADC clock prescaler is selected using
+     * picolibrary::Microchip::megaAVR::ADC::auto_triggered_adc_clock_prescaler().
+     *
+     * \param[in] adc The ADC to be used by the converter.
+     * \param[in] sample_clock The sample clock used to trigger conversions.
+     * \param[in] adc_voltage_reference The desired ADC voltage reference.
+     * \param[in] adc_input The desired ADC input.
+     */
+    Timer_Triggered_Block_Converter(
+        Peripheral::ADC &     adc,
+        TC1_Sample_Clock &    sample_clock,
+        ADC_Voltage_Reference adc_voltage_reference,
+        ADC_Input             adc_input ) noexcept :
+        Timer_Triggered_Block_Converter{
+            adc,
+            sample_clock,
+            adc_voltage_reference,
+            adc_input,
+            auto_triggered_adc_clock_prescaler( F_CPU, sample_clock.sample_rate() ) }
+    {
+    }
+
+    Timer_Triggered_Block_Converter( Timer_Triggered_Block_Converter && ) = delete;
+
+    Timer_Triggered_Block_Converter( Timer_Triggered_Block_Converter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Timer_Triggered_Block_Converter() noexcept
+    {
+        stop();
+
+        m_adc->adcsra = 0;
+
+        Power::release( *m_adc );
+    }
+
+    auto operator=( Timer_Triggered_Block_Converter && ) = delete;
+
+    auto operator=( Timer_Triggered_Block_Converter const & ) = delete;
+
+    /**
+     * \brief Initialize the converter's hardware (including the sample clock's
+     *        hardware).
+     */
+    void initialize() noexcept
+    {
+        m_sample_clock->initialize();
+
+        m_adc->adcsra = m_configuration.adcsra();
+        m_adc->adcsrb = m_configuration.adcsrb() | to_underlying( m_sample_clock->trigger_event() );
+        m_adc->admux  = m_configuration.admux();
+
+        m_configuration.disable_digital_input_buffer( *m_adc );
+    }
+
+    /**
+     * \brief Start sampling.
+     *
+     * \attention Any block that has not been released is discarded.
+     */
+    void start() noexcept
+    {
+        m_fill_block  = 0;
+        m_fill_count  = 0;
+        m_block_ready = false;
+
+        m_adc->adcsra = m_configuration.adcsra() | Peripheral::ADC::ADCSRA::Mask::ADATE
+                        | Peripheral::ADC::ADCSRA::Mask::ADIF | Peripheral::ADC::ADCSRA::Mask::ADIE;
+
+        m_sample_clock->start();
+    }
+
+    /**
+     * \brief Stop sampling.
+     */
+    void stop() noexcept
+    {
+        m_sample_clock->stop();
+
+        m_adc->adcsra = m_configuration.adcsra();
+    }
+
+    /**
+     * \brief Check if a full block is ready.
+     *
+     * \return true if a full block is ready.
+     * \return false if a full block is not ready.
+     */
+    auto block_is_ready() const noexcept -> bool
+    {
+        return m_block_ready;
+    }
+
+    /**
+     * \brief Get the ready block.
+     *
+     * \pre a full block is ready
+     *
+     * \return The ready block (BLOCK_SIZE samples, oldest first). The block remains
+     *         valid until it is released.
+     */
+    auto block() const noexcept -> std::uint16_t const volatile *
+    {
+        PICOLIBRARY_EXPECT( block_is_ready(), Generic_Error::LOGIC_ERROR );
+
+        return m_blocks[ m_fill_block ^ 1 ];
+    }
+
+    /**
+     * \brief Release the ready block so that it can be refilled.
+     */
+    void release_block() noexcept
+    {
+        m_block_ready = false;
+    }
+
+    /**
+     * \brief Get the number of blocks that have been dropped because the previous block
+     *        had not been released (saturates at 255).
+     *
+     * \return The number of blocks that have been dropped.
+     */
+    auto dropped_blocks() const noexcept -> std::uint_fast8_t
+    {
+        return m_dropped_blocks;
+    }
+
+    /**
+     * \brief Clear the dropped block count.
+     */
+    void clear_dropped_blocks() noexcept
+    {
+        m_dropped_blocks = 0;
+    }
+
+    /**
+     * \brief Handle a conversion complete interrupt.
+     *
+     * \attention This function must be called from the ADC conversion complete
+     *            interrupt's ISR.
+     */
+    void handle_conversion_complete_interrupt() noexcept
+    {
+        m_sample_clock->acknowledge_trigger();
+
+        auto const fill_count = m_fill_count;
+
+        m_blocks[ m_fill_block ][ fill_count ] = m_adc->adc;
+
+        if ( fill_count + 1 < BLOCK_SIZE ) {
+            m_fill_count = fill_count + 1;
+
+            return;
+        } // if
+
+        m_fill_count = 0;
+
+        handle_full_block();
+    }
+
+  private:
+    /**
+     * \brief The ADC used by the converter.
+     */
+    Peripheral::ADC * m_adc;
+
+    /**
+     * \brief The sample clock used to trigger conversions.
+     */
+    TC1_Sample_Clock * m_sample_clock;
+
+    /**
+     * \brief The converter's input selection and clock configuration.
+     */
+    Input_Configuration m_configuration;
+
+    /**
+     * \brief The blocks.
+     */
+    std::uint16_t volatile m_blocks[ 2 ][ BLOCK_SIZE ]{};
+
+    /**
+     * \brief The index of the block that is being filled.
+     */
+    std::uint8_t volatile m_fill_block{};
+
+    /**
+     * \brief The number of samples in the block that is being filled.
+     */
+    std::uint8_t volatile m_fill_count{};
+
+    /**
+     * \brief The ready block flag (the ready block is the block that is not being
+     *        filled).
+     */
+    bool volatile m_block_ready{};
+
+    /**
+     * \brief The number of blocks that have been dropped.
+     */
+    std::uint8_t volatile m_dropped_blocks{};
+
+    /**
+     * \brief Hand a full block to the application (or drop it if the previous block has
+     *        not been released).
+     */
+    void handle_full_block() noexcept
+    {
+        if ( m_block_ready ) {
+            if ( m_dropped_blocks != 0xFF ) {
+                m_dropped_blocks = m_dropped_blocks + 1;
+            } // if
+
+            return;
+        } // if
+
+        m_fill_block  = m_fill_block ^ 1;
+        m_block_ready = true;
+    }
+};
+
+/**
+ * \brief Scan sequencer channel.
+ *
+ * \tparam ADC_INPUT The channel's ADC input.
+ * \tparam OVERSAMPLING_BITS The number of extra bits of resolution to get by
+ *         oversampling and decimating (4^OVERSAMPLING_BITS samples are accumulated per
+ *         result, must be no larger than 3).
+ */
+template<ADC_Input ADC_INPUT, std::uint_fast8_t OVERSAMPLING_BITS = 0>
+struct Scan_Channel {
+    static_assert( OVERSAMPLING_BITS <= 3 );
+
+    /**
+     * \brief The channel's ADC input.
+     */
+    static constexpr auto INPUT = ADC_INPUT;
+
+    /**
+     * \brief The number of extra bits of resolution to get by oversampling and
+     *        decimating.
+     */
+    static constexpr auto EXTRA_BITS = std::uint8_t{ OVERSAMPLING_BITS };
+};
+
+/**
+ * \brief Scan sequencer input settling behavior.
+ */
+enum class Scan_Settling : std::uint8_t {
+    NONE,                 ///< Use every sample.
+    DISCARD_FIRST_SAMPLE, ///< Discard the first sample after switching inputs.
+};
+
+/**
+ * \brief Interrupt driven, multi-channel scan sequencer.
+ *
+ * The sequencer converts its channels round-robin.
+ * picolibrary::Microchip::megaAVR::ADC::Scan_Sequencer::handle_conversion_complete_interrupt()
+ * (which must be called from the ADC conversion complete interrupt's ISR) accumulates
+ * each sample, switches ADMUX to the next channel once a channel's result is complete,
+ * and starts the next conversion. ADMUX is only changed while no conversion is in
+ * progress, so every sample belongs to the channel it is accumulated for.
+ *
+ * When a scan of all channels completes, the result table is published. Readers copy the
+ * published table without disabling interrupts, retrying if a scan completes during
+ * the copy.
+ *
+ * \tparam CHANNELS The channels to scan (picolibrary::Microchip::megaAVR::ADC::Scan_Channel
+ *         specializations), in scan order.
+ */
+template<typename... CHANNELS>
+class Scan_Sequencer {
+  public:
+    static_assert( sizeof...( CHANNELS ) > 0 and sizeof...( CHANNELS ) <= 16 );
+
+    /**
+     * \brief The number of channels.
+     */
+    static constexpr auto CHANNEL_COUNT = std::uint_fast8_t{ sizeof...( CHANNELS ) };
+
+    /**
+     * \brief Channel result (10 + the channel's extra bits of resolution).
+     */
+    using Result = std::uint16_t;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] adc The ADC to be used by the sequencer.
+     * \param[in] adc_voltage_reference The desired ADC voltage reference.
+     * \param[in] scan_settling The desired input settling behavior.
+     * \param[in] adc_clock_prescaler The desired ADC clock prescaler.
+     */
+    Scan_Sequencer(
+        Peripheral::ADC &     adc,
+        ADC_Voltage_Reference adc_voltage_reference,
+        Scan_Settling         scan_settling,
+        ADC_Clock_Prescaler adc_clock_prescaler = maximum_resolution_adc_clock_prescaler( F_CPU ) ) noexcept :
+        m_adc{ &adc },
+        m_adc_voltage_reference{ adc_voltage_reference },
+        m_adc_clock_prescaler{ adc_clock_prescaler },
+        m_scan_settling{ scan_settling }
+    {
+        Power::acquire( adc );
+    }
+
+    Scan_Sequencer( Scan_Sequencer && ) = delete;
+
+    Scan_Sequencer( Scan_Sequencer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Scan_Sequencer() noexcept
+    {
+        m_adc->adcsra = 0;
+
+        Power::release( *m_adc );
+    }
+
+    auto operator=( Scan_Sequencer && ) = delete;
+
+    auto operator=( Scan_Sequencer const & ) = delete;
+
+    /**
+     * \brief Initialize the sequencer's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_adc->adcsra = configuration( 0 ).adcsra();
+        m_adc->adcsrb = 0;
+
+        for ( auto channel = std::uint_fast8_t{}; channel < CHANNEL_COUNT; ++channel ) {
+            configuration( channel ).disable_digital_input_buffer( *m_adc );
+        } // for
+    }
+
+    /**
+     * \brief Start scanning (from the first channel).
+     */
+    void start() noexcept
+    {
+        m_channel     = 0;
+        m_count       = 0;
+        m_accumulator = 0;
+        m_discard     = m_scan_settling == Scan_Settling::DISCARD_FIRST_SAMPLE;
+
+        configuration( 0 ).select( *m_adc );
+
+        m_adc->adcsra = configuration( 0 ).adcsra() | Peripheral::ADC::ADCSRA::Mask::ADIF
+                        | Peripheral::ADC::ADCSRA::Mask::ADIE | Peripheral::ADC::ADCSRA::Mask::ADSC;
+    }
+
+    /**
+     * \brief Stop scanning.
+     *
+     * \attention A conversion that is in progress when scanning is stopped will
+     *            complete, but its sample will not be used.
+     */
+    void stop() noexcept
+    {
+        m_adc->adcsra = configuration( 0 ).adcsra();
+    }
+
+    /**
+     * \brief Get the number of scans that have been published (wraps).
+     *
+     * \return The number of scans that have been published.
+     */
+    auto scan_count() const noexcept -> std::uint_fast8_t
+    {
+        return m_scan_count;
+    }
+
+    /**
+     * \brief Get the most recently published result table.
+     *
+     * \param[out] results The location to write the result table to (indexed by channel
+     *             scan order).
+     *
+     * \return The scan count associated with the result table.
+     */
+    auto results( Result ( &results )[ CHANNEL_COUNT ] ) const noexcept -> std::uint_fast8_t
+    {
+        for ( ;; ) {
+            std::uint8_t const scan_count = m_scan_count;
+
+            for ( auto channel = std::uint_fast8_t{}; channel < CHANNEL_COUNT; ++channel ) {
+                results[ channel ] = m_published[ channel ];
+            } // for
+
+            if ( scan_count == m_scan_count ) {
+                return scan_count;
+            } // if
+        }     // for
+    }
+
+    /**
+     * \brief Handle a conversion complete interrupt.
+     *
+     * \attention This function must be called from the ADC conversion complete
+     *            interrupt's ISR.
+     */
+    void handle_conversion_complete_interrupt() noexcept
+    {
+        std::uint16_t const sample = m_adc->adc;
+
+        if ( m_discard ) {
+            m_discard = false;
+        } else if ( accumulate( sample ) ) {
+            complete_channel();
+        } // else if
+
+        m_adc->adcsra = configuration( 0 ).adcsra() | Peripheral::ADC::ADCSRA::Mask::ADIE
+                        | Peripheral::ADC::ADCSRA::Mask::ADSC;
+    }
+
+  private:
+    /**
+     * \brief The channel ADC inputs.
+     */
+    static constexpr ADC_Input INPUTS[] = { CHANNELS::INPUT... };
+
+    /**
+     * \brief The channel extra bits of resolution.
+     */
+    static constexpr std::uint8_t EXTRA_BITS[] = { CHANNELS::EXTRA_BITS... };
+
+    /**
+     * \brief The ADC used by the sequencer.
+     */
+    Peripheral::ADC * m_adc;
+
+    /**
+     * \brief The ADC voltage reference.
+     */
+    ADC_Voltage_Reference m_adc_voltage_reference;
+
+    /**
+     * \brief The ADC clock prescaler.
+     */
+    ADC_Clock_Prescaler m_adc_clock_prescaler;
+
+    /**
+     * \brief The input settling behavior.
+     */
+    Scan_Settling m_scan_settling;
+
+    /**
+     * \brief The channel that is being converted.
+     */
+    std::uint8_t volatile m_channel{};
+
+    /**
+     * \brief The discard next sample flag.
+     */
+    bool volatile m_discard{};
+
+    /**
+     * \brief The number of samples that have been accumulated for the channel that is
+     *        being converted.
+     */
+    std::uint8_t volatile m_count{};
+
+    /**
+     * \brief The sample accumulator for the channel that is being converted.
+     */
+    std::uint16_t volatile m_accumulator{};
+
+    /**
+     * \brief The results of the scan that is in progress.
+     */
+    Result m_working[ CHANNEL_COUNT ]{};
+
+    /**
+     * \brief The published result table.
+     */
+    Result volatile m_published[ CHANNEL_COUNT ]{};
+
+    /**
+     * \brief The number of scans that have been published.
+     */
+    std::uint8_t volatile m_scan_count{};
+
+    /**
+     * \brief Get a channel's input selection and clock configuration.
+     *
+     * \param[in] channel The channel.
+     *
+     * \return The channel's input selection and clock configuration.
+     */
+    auto configuration( std::uint_fast8_t channel ) const noexcept -> Input_Configuration
+    {
+        return { m_adc_voltage_reference, INPUTS[ channel ], m_adc_clock_prescaler };
+    }
+
+    /**
+     * \brief Accumulate a sample for the channel that is being converted.
+     *
+     * \param[in] sample The sample.
+     *
+     * \return true if the channel's result is complete.
+     * \return false if the channel's result is not complete.
+     */
+    auto accumulate( std::uint16_t sample ) noexcept -> bool
+    {
+        m_accumulator = m_accumulator + sample;
+        m_count       = m_count + 1;
+
+        return m_count == ( 1 << ( 2 * EXTRA_BITS[ m_channel ] ) );
+    }
+
+    /**
+     * \brief Store the result of the channel that is being converted and switch to the
+     *        next channel (publishing the result table if the scan is complete).
+     */
+    void complete_channel() noexcept
+    {
+        auto const channel = m_channel;
+
+        m_working[ channel ] = m_accumulator >> EXTRA_BITS[ channel ];
+
+        m_accumulator = 0;
+        m_count       = 0;
+
+        auto const next_channel = channel + 1 < CHANNEL_COUNT ? channel + 1 : 0;
+
+        if ( not next_channel ) {
+            publish();
+        } // if
+
+        if ( next_channel != channel ) {
+            m_channel = next_channel;
+            m_discard = m_scan_settling == Scan_Settling::DISCARD_FIRST_SAMPLE;
+
+            configuration( next_channel ).select( *m_adc );
+        } // if
+    }
+
+    /**
+     * \brief Publish the result table.
+     */
+    void publish() noexcept
+    {
+        for ( auto channel = std::uint_fast8_t{}; channel < CHANNEL_COUNT; ++channel ) {
+            m_published[ channel ] = m_working[ channel ];
+        } // for
+
+        m_scan_count = m_scan_count + 1;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::ADC
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_ADC_H
@@ -27,7 +27,10 @@
 #include <type_traits>
 
 #include "picolibrary/asynchronous_serial.h"
+#include "picolibrary/microchip/megaavr/clock.h"
+#include "picolibrary/microchip/megaavr/interrupt.h"
 #include "picolibrary/microchip/megaavr/peripheral/usart.h"
+#include "picolibrary/microchip/megaavr/power.h"
 #include "picolibrary/utility.h"
 
 /**
@@ -123,6 +126,8 @@ class Basic_Transmitter {
         std::uint16_t usart_clock_generator_scaling_factor ) noexcept :
         m_usart{ &usart }
     {
+        Power::acquire( usart );
+
         configure_transmitter(
             usart_data_bits, usart_parity, usart_stop_bits, usart_clock_generator_operating_speed, usart_clock_generator_scaling_factor );
     }
@@ -133,7 +138,9 @@ class Basic_Transmitter {
      * \param[in] source The source of the move.
      */
     constexpr Basic_Transmitter( Basic_Transmitter && source ) noexcept :
-        m_usart{ source.m_usart }
+        m_usart{ source.m_usart },
+        m_ubrr{ source.m_ubrr },
+        m_transmit_complete_flag_is_valid{ source.m_transmit_complete_flag_is_valid }
     {
         source.m_usart = nullptr;
     }
@@ -160,7 +167,9 @@ class Basic_Transmitter {
         if ( &expression != this ) {
             disable();
 
-            m_usart = expression.m_usart;
+            m_usart                           = expression.m_usart;
+            m_ubrr                            = expression.m_ubrr;
+            m_transmit_complete_flag_is_valid = expression.m_transmit_complete_flag_is_valid;
 
             expression.m_usart = nullptr;
         } // if
@@ -187,7 +196,20 @@ class Basic_Transmitter {
     {
         while ( not transmit_buffer_is_empty() ) {} // while
 
-        load_transmit_buffer( data );
+        start_transmission( data );
+    }
+
+    /**
+     * \brief Handle a system clock prescaler change.
+     *
+     * \param[in] previous_shift The previous clock shift.
+     * \param[in] shift The new clock shift.
+     */
+    void handle_clock_change( std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept
+    {
+        static_cast<void>( previous_shift );
+
+        m_usart->normal.ubrr = Clock::scale_ubrr( m_ubrr, shift );
     }
 
   private:
@@ -196,13 +218,36 @@ class Basic_Transmitter {
      */
     Peripheral::USART * m_usart{};
 
+    /**
+     * \brief The USART clock generator scaling factor (UBRR register value) the
+     *        transmitter was configured with (unscaled system clock).
+     */
+    std::uint16_t m_ubrr{};
+
+    /**
+     * \brief Data has been loaded into the transmit buffer since the transmitter was
+     *        constructed (TXC will be set once the data has been transmitted).
+     */
+    bool m_transmit_complete_flag_is_valid{};
+
     /**
      * \brief Disable the transmitter.
+     *
+     * Any data that has been loaded into the transmit buffer is transmitted before the
+     * transmitter is disabled and the USART is powered down.
      */
     constexpr void disable() noexcept
     {
         if ( m_usart ) {
+            if ( m_transmit_complete_flag_is_valid ) {
+                while ( not transmit_buffer_is_empty() ) {} // while
+
+                while ( not transmission_is_complete() ) {} // while
+            } // if
+
             disable_transmitter();
+
+            Power::release( *m_usart );
         } // if
     }
 
@@ -232,6 +277,8 @@ class Basic_Transmitter {
                                 | to_underlying( usart_parity ) | to_underlying( usart_stop_bits );
         m_usart->normal.ucsra = to_underlying( usart_clock_generator_operating_speed );
         m_usart->normal.ubrr  = usart_clock_generator_scaling_factor;
+
+        m_ubrr = usart_clock_generator_scaling_factor;
     }
 
     /**
@@ -282,6 +329,50 @@ class Basic_Transmitter {
                                 | ( data & 0x0100 ? Peripheral::USART::Normal::UCSRB::Mask::TXB8 : 0 );
         m_usart->normal.udr = data;
     }
+
+    /**
+     * \brief Clear the transmit complete flag (TXC).
+     */
+    void clear_transmit_complete_flag() noexcept
+    {
+        m_usart->normal.ucsra = ( m_usart->normal.ucsra
+                                  & ( Peripheral::USART::Normal::UCSRA::Mask::U2X
+                                      | Peripheral::USART::Normal::UCSRA::Mask::MPCM ) )
+                                | Peripheral::USART::Normal::UCSRA::Mask::TXC;
+
+        m_transmit_complete_flag_is_valid = true;
+    }
+
+    /**
+     * \brief Load data into the transmit buffer and clear the transmit complete flag
+     *        (TXC).
+     *
+     * TXC is cleared immediately after the data is loaded, with interrupts disabled.
+     * Clearing TXC before loading the data would race with the completion of the previous
+     * transmission, and an interrupt between loading the data and clearing TXC could
+     * delay the clear until after the loaded data has been transmitted (clearing the only
+     * TXC that will be set).
+     *
+     * \param[in] data The data to load into the transmit buffer.
+     */
+    void start_transmission( Data data ) noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        load_transmit_buffer( data );
+        clear_transmit_complete_flag();
+    }
+
+    /**
+     * \brief Check if transmission is complete.
+     *
+     * \return true if transmission is complete.
+     * \return false if transmission is not complete.
+     */
+    auto transmission_is_complete() const noexcept -> bool
+    {
+        return m_usart->normal.ucsra & Peripheral::USART::Normal::UCSRA::Mask::TXC;
+    }
 };
 
 /**
@@ -0,0 +1,391 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Clock interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_CLOCK_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_CLOCK_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/spi.h"
+#include "picolibrary/microchip/megaavr/peripheral/sysctrl.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Microchip megaAVR system clock facilities.
+ *
+ * A clock shift is the base 2 logarithm of the ratio between the system clock frequency
+ * that driver configurations were computed for (the frequency passed to
+ * picolibrary::Microchip::megaAVR::Clock::Service's constructor, F_CPU by default) and
+ * the current system clock frequency (positive if the system clock has been slowed down).
+ */
+namespace picolibrary::Microchip::megaAVR::Clock {
+
+/**
+ * \brief System clock prescaler.
+ */
+enum class Prescaler : std::uint8_t {
+    DIVIDE_BY_1   = 0, ///< Divide by 1.
+    DIVIDE_BY_2   = 1, ///< Divide by 2.
+    DIVIDE_BY_4   = 2, ///< Divide by 4.
+    DIVIDE_BY_8   = 3, ///< Divide by 8.
+    DIVIDE_BY_16  = 4, ///< Divide by 16.
+    DIVIDE_BY_32  = 5, ///< Divide by 32.
+    DIVIDE_BY_64  = 6, ///< Divide by 64.
+    DIVIDE_BY_128 = 7, ///< Divide by 128.
+    DIVIDE_BY_256 = 8, ///< Divide by 256.
+};
+
+/**
+ * \brief Scale a clock divider to compensate for a clock shift change.
+ *
+ * \param[in] divider The clock divider to scale.
+ * \param[in] change The clock shift change.
+ *
+ * \return The scaled clock divider.
+ */
+constexpr auto scale_divider( std::uint32_t divider, std::int_fast8_t change ) noexcept -> std::uint32_t
+{
+    return change >= 0 ? divider >> change : divider << -change;
+}
+
+/**
+ * \brief Scale a USART clock generator scaling factor (UBRR register value) to compensate
+ *        for a clock shift change.
+ *
+ * \param[in] ubrr The UBRR register value to scale.
+ * \param[in] change The clock shift change.
+ *
+ * \return The scaled UBRR register value (saturated if the USART's baud rate cannot be
+ *         maintained).
+ */
+constexpr auto scale_ubrr( std::uint16_t ubrr, std::int_fast8_t change ) noexcept -> std::uint16_t
+{
+    auto const divider = scale_divider( std::uint32_t{ ubrr } + 1, change );
+
+    if ( not divider ) {
+        return 0;
+    } // if
+
+    return divider > 0x1000 ? 0x0FFF : divider - 1;
+}
+
+/**
+ * \brief Scale a TWI bit rate generator scaling factor (TWBR register value) to
+ *        compensate for a clock shift change.
+ *
+ * \param[in] twbr The TWBR register value to scale.
+ * \param[in] twps The TWI bit rate generator prescaler (TWSR register TWPS field value).
+ * \param[in] change The clock shift change.
+ *
+ * \return The scaled TWBR register value (saturated if the TWI's bit rate cannot be
+ *         maintained).
+ */
+constexpr auto scale_twbr( std::uint8_t twbr, std::uint_fast8_t twps, std::int_fast8_t change ) noexcept
+    -> std::uint8_t
+{
+    auto const prescaler = std::uint32_t{ 1 } << ( 2 * twps );
+    auto const divider   = scale_divider( 16 + 2 * twbr * prescaler, change );
+
+    if ( divider <= 16 ) {
+        return 0;
+    } // if
+
+    auto const scaled_twbr = ( divider - 16 ) / ( 2 * prescaler );
+
+    return scaled_twbr > 0xFF ? 0xFF : scaled_twbr;
+}
+
+/**
+ * \brief Scale an SPI clock rate (SPCR register SPR field and SPSR register SPI2X field
+ *        values) to compensate for a clock shift change.
+ *
+ * \param[in,out] spcr The SPCR register value to scale.
+ * \param[in,out] spsr The SPSR register value to scale.
+ * \param[in] change The clock shift change.
+ */
+constexpr void scale_spi_clock_rate( std::uint8_t & spcr, std::uint8_t & spsr, std::int_fast8_t change ) noexcept
+{
+    auto const spr = ( spcr & Peripheral::SPI::SPCR::Mask::SPR ) >> Peripheral::SPI::SPCR::Bit::SPR;
+
+    // SPI clock rate = fosc / 2^exponent (1 <= exponent <= 7)
+    auto exponent = ( spr == 0b11 ? 7 : 2 + 2 * spr ) - ( spsr & Peripheral::SPI::SPSR::Mask::SPI2X ? 1 : 0 ) - change;
+
+    exponent = exponent < 1 ? 1 : exponent > 7 ? 7 : exponent;
+
+    spcr = ( spcr & ~Peripheral::SPI::SPCR::Mask::SPR )
+           | ( ( exponent == 7 ? 0b11 : ( exponent - 1 ) / 2 ) << Peripheral::SPI::SPCR::Bit::SPR );
+    spsr = exponent != 7 and exponent & 0b1 ? Peripheral::SPI::SPSR::Mask::SPI2X : 0;
+}
+
+class Service;
+
+/**
+ * \brief System clock change listener.
+ *
+ * A listener calls the bound driver's `handle_clock_change( std::int_fast8_t
+ * previous_shift, std::int_fast8_t shift )` member function when the system clock
+ * prescaler is changed.
+ *
+ * \attention Listeners are linked into a service's listener list in place. A listener
+ *            must therefore be removed from the service before it is destroyed. The
+ *            bound driver must not be moved while the listener is in a service's listener
+ *            list.
+ */
+class Listener {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Listener() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Driver The type of driver to notify.
+     *
+     * \param[in] driver The driver to notify.
+     */
+    template<typename Driver>
+    constexpr Listener( Driver & driver ) noexcept :
+        m_driver{ &driver },
+        m_handler{ &handle_clock_change<Driver> }
+    {
+    }
+
+    Listener( Listener && ) = delete;
+
+    Listener( Listener const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Listener() noexcept = default;
+
+    auto operator=( Listener && ) = delete;
+
+    auto operator=( Listener const & ) = delete;
+
+  private:
+    friend class Service;
+
+    /**
+     * \brief Clock change handler.
+     */
+    using Handler = void ( * )( void * driver, std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept;
+
+    /**
+     * \brief The next listener in the service's listener list.
+     */
+    Listener * m_next{};
+
+    /**
+     * \brief The driver to notify.
+     */
+    void * m_driver{};
+
+    /**
+     * \brief The clock change handler.
+     */
+    Handler m_handler{};
+
+    /**
+     * \brief Notify a driver of a clock change.
+     *
+     * \tparam Driver The type of driver to notify.
+     *
+     * \param[in] driver The driver to notify.
+     * \param[in] previous_shift The previous clock shift.
+     * \param[in] shift The new clock shift.
+     */
+    template<typename Driver>
+    static void handle_clock_change( void * driver, std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept
+    {
+        static_cast<Driver *>( driver )->handle_clock_change( previous_shift, shift );
+    }
+};
+
+/**
+ * \brief System clock prescaler service.
+ */
+class Service {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Service() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] sysctrl The SYSCTRL peripheral.
+     * \param[in] frequency The system clock frequency when the service is constructed
+     *            (the frequency driver configurations were computed for).
+     */
+    Service( Peripheral::SYSCTRL & sysctrl, std::uint32_t frequency = F_CPU ) noexcept :
+        m_sysctrl{ &sysctrl },
+        m_frequency{ frequency },
+        m_prescaler{ prescaler() }
+    {
+    }
+
+    Service( Service && ) = delete;
+
+    Service( Service const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Service() noexcept = default;
+
+    auto operator=( Service && ) = delete;
+
+    auto operator=( Service const & ) = delete;
+
+    /**
+     * \brief Add a listener to the service.
+     *
+     * The listener's driver is immediately notified of the current clock shift.
+     *
+     * \param[in] listener The listener to add.
+     */
+    void add( Listener & listener ) noexcept
+    {
+        listener.m_next = m_listeners;
+        m_listeners     = &listener;
+
+        listener.m_handler( listener.m_driver, 0, shift() );
+    }
+
+    /**
+     * \brief Remove a listener from the service.
+     *
+     * \param[in] listener The listener to remove.
+     */
+    void remove( Listener & listener ) noexcept
+    {
+        for ( auto link = &m_listeners; *link; link = &( *link )->m_next ) {
+            if ( *link == &listener ) {
+                *link = listener.m_next;
+
+                return;
+            } // if
+        } // for
+    }
+
+    /**
+     * \brief Get the current system clock prescaler.
+     *
+     * \return The current system clock prescaler.
+     */
+    auto prescaler() const noexcept -> Prescaler
+    {
+        return static_cast<Prescaler>( m_sysctrl->clkpr & Peripheral::SYSCTRL::CLKPR::Mask::CLKPS );
+    }
+
+    /**
+     * \brief Get the current clock shift.
+     *
+     * \return The current clock shift.
+     */
+    auto shift() const noexcept -> std::int_fast8_t
+    {
+        return static_cast<std::int_fast8_t>( to_underlying( prescaler() ) )
+               - static_cast<std::int_fast8_t>( to_underlying( m_prescaler ) );
+    }
+
+    /**
+     * \brief Get the current system clock frequency.
+     *
+     * \return The current system clock frequency.
+     */
+    auto frequency() const noexcept -> std::uint32_t
+    {
+        return scale_divider( m_frequency, shift() );
+    }
+
+    /**
+     * \brief Change the system clock prescaler and notify listeners.
+     *
+     * \attention This function must not be called while a driver that is notified is
+     *            transmitting or receiving data.
+     *
+     * \param[in] prescaler The desired system clock prescaler.
+     */
+    void set_prescaler( Prescaler prescaler ) noexcept
+    {
+        auto const previous_shift = shift();
+
+        write_prescaler( prescaler );
+
+        auto const new_shift = shift();
+
+        for ( auto listener = m_listeners; listener; listener = listener->m_next ) {
+            listener->m_handler( listener->m_driver, previous_shift, new_shift );
+        } // for
+    }
+
+  private:
+    /**
+     * \brief The SYSCTRL peripheral.
+     */
+    Peripheral::SYSCTRL * m_sysctrl{};
+
+    /**
+     * \brief The system clock frequency when the service was constructed.
+     */
+    std::uint32_t m_frequency{};
+
+    /**
+     * \brief The system clock prescaler when the service was constructed.
+     */
+    Prescaler m_prescaler{};
+
+    /**
+     * \brief The listener list.
+     */
+    Listener * m_listeners{};
+
+    /**
+     * \brief Write the system clock prescaler.
+     *
+     * \param[in] prescaler The desired system clock prescaler.
+     */
+    void write_prescaler( Prescaler prescaler ) noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        // CLKPS must be written no more than 4 clock cycles after CLKPCE is set
+        asm volatile(
+            "st %a[clkpr], %[clkpce]\n\t"
+            "st %a[clkpr], %[clkps]"
+            :
+            : [clkpr] "e"( &m_sysctrl->clkpr ),
+              [clkpce] "r"( Peripheral::SYSCTRL::CLKPR::Mask::CLKPCE ),
+              [clkps] "r"( to_underlying( prescaler ) )
+            : "memory" );
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Clock
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_CLOCK_H
@@ -0,0 +1,126 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Crash_Record interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_CRASH_RECORD_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_CRASH_RECORD_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+
+/**
+ * \brief Microchip megaAVR post-mortem crash record facilities.
+ *
+ * A crash record is stored in the `.noinit` section, which is not initialized during
+ * startup, so it survives any reset that does not remove power (e.g. a watchdog system
+ * reset).
+ */
+namespace picolibrary::Microchip::megaAVR::Crash_Record {
+
+#if defined( __AVR_ATmega2560__ )
+/**
+ * \brief Return address (word address, the ATmega2560 has a 3 byte program counter).
+ */
+using Return_Address = std::uint32_t;
+#else  // defined( __AVR_ATmega2560__ )
+/**
+ * \brief Return address (word address).
+ */
+using Return_Address = std::uint16_t;
+#endif // defined( __AVR_ATmega2560__ )
+
+/**
+ * \brief Crash record.
+ */
+struct Record {
+    /**
+     * \brief The error's category ID (the address of the error's category).
+     */
+    std::uint16_t category_id;
+
+    /**
+     * \brief The error's description ID.
+     */
+    std::uint8_t description_id;
+
+    /**
+     * \brief The return address of the function that captured the crash record.
+     *
+     * The return address is a word address (the program counter value, e.g. the address
+     * returned by `__builtin_return_address( 0 )`). Multiply it by 2 to get the byte
+     * address used by tools such as avr-objdump and avr-addr2line.
+     */
+    Return_Address return_address;
+
+    /**
+     * \brief The stack pointer when the crash record was captured.
+     */
+    std::uint16_t stack_pointer;
+
+    /**
+     * \brief The MCUSR value (reset cause) when the crash record was recovered.
+     */
+    std::uint8_t mcusr;
+};
+
+/**
+ * \brief Capture a crash record.
+ *
+ * \attention This function is intended to be called by picolibrary::trap_fatal_error()
+ *            before the system is reset.
+ *
+ * \param[in] cpu The CPU peripheral.
+ * \param[in] error The fatal error.
+ * \param[in] return_address The return address (word address) of the function that is
+ *            capturing the crash record (e.g. `__builtin_return_address( 0 )`, which
+ *            only provides the 2 least significant bytes of the ATmega2560's 3 byte
+ *            program counter).
+ */
+void capture( Peripheral::CPU & cpu, Error_Code const & error, Return_Address return_address ) noexcept;
+
+/**
+ * \brief Recover the crash record captured before the most recent reset (if any), and
+ *        get and clear the reset cause.
+ *
+ * The stored crash record is invalidated, so a crash record is only recovered once. The
+ * reset cause is gotten using
+ * picolibrary::Microchip::megaAVR::Watchdog::consume_reset_cause(), so if the reset cause
+ * was saved by picolibrary::Microchip::megaAVR::Watchdog::save_reset_cause_and_disable()
+ * during startup, this function can be called at any time after startup.
+ *
+ * \attention If the reset cause is not saved during startup, this function must be
+ *            called before picolibrary::Microchip::megaAVR::Watchdog::disable() (which
+ *            clears WDRF) is called.
+ *
+ * \param[in] cpu The CPU peripheral.
+ * \param[out] record The recovered crash record (only the reset cause is written if no
+ *             crash record was captured before the most recent reset).
+ *
+ * \return true if a crash record was recovered.
+ * \return false if no crash record was captured before the most recent reset.
+ */
+auto recover( Peripheral::CPU & cpu, Record & record ) noexcept -> bool;
+
+} // namespace picolibrary::Microchip::megaAVR::Crash_Record
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_CRASH_RECORD_H
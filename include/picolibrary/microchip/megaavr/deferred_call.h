@@ -0,0 +1,334 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Deferred_Call interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_DEFERRED_CALL_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_DEFERRED_CALL_H
+
+#include <cstdint>
+
+/**
+ * \brief Microchip megaAVR deferred call facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Deferred_Call {
+
+/**
+ * \brief Delegate (object pointer and compile time member function).
+ */
+class Delegate {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Delegate() noexcept = default;
+
+    /**
+     * \brief Create a delegate that calls an object's member function.
+     *
+     * \tparam HANDLER The member function to call.
+     * \tparam T The type of object whose member function is called.
+     *
+     * \param[in] object The object whose member function is called.
+     *
+     * \return The delegate.
+     */
+    template<auto HANDLER, typename T>
+    static constexpr auto bind( T & object ) noexcept -> Delegate
+    {
+        return Delegate{ &object, &call<T, HANDLER> };
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Delegate( Delegate && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Delegate( Delegate const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Delegate() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Delegate && expression ) noexcept -> Delegate & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Delegate const & expression ) noexcept -> Delegate & = default;
+
+    /**
+     * \brief Check if the delegate is bound to an object's member function.
+     *
+     * \return true if the delegate is bound to an object's member function.
+     * \return false if the delegate is not bound to an object's member function.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return m_function;
+    }
+
+    /**
+     * \brief Call the object's member function.
+     */
+    void operator()() const noexcept
+    {
+        m_function( m_object );
+    }
+
+  private:
+    /**
+     * \brief Member function call function.
+     */
+    using Function = void ( * )( void * ) noexcept;
+
+    /**
+     * \brief The object whose member function is called.
+     */
+    void * m_object{};
+
+    /**
+     * \brief The member function call function.
+     */
+    Function m_function{};
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] object The object whose member function is called.
+     * \param[in] function The member function call function.
+     */
+    constexpr Delegate( void * object, Function function ) noexcept :
+        m_object{ object },
+        m_function{ function }
+    {
+    }
+
+    /**
+     * \brief Call an object's member function.
+     *
+     * \tparam T The type of object whose member function is called.
+     * \tparam HANDLER The member function to call.
+     *
+     * \param[in] object The object whose member function is called.
+     */
+    template<typename T, auto HANDLER>
+    static void call( void * object ) noexcept
+    {
+        ( static_cast<T *>( object )->*HANDLER )();
+    }
+};
+
+/**
+ * \brief Fixed capacity deferred call queue.
+ *
+ * ISRs post delegates to the queue
+ * (picolibrary::Microchip::megaAVR::Deferred_Call::Queue::post()), and the main context
+ * calls them (picolibrary::Microchip::megaAVR::Deferred_Call::Queue::run_pending()), so
+ * ISRs can hand work that does not need to be done immediately to the main context. The
+ * queue is a single producer, single consumer ring buffer with 8-bit indices, so neither
+ * side needs a critical section. Calls that are posted while the queue is full are dropped
+ * and counted.
+ *
+ * \tparam CAPACITY The maximum number of pending calls the queue can hold (must be a power
+ *         of two no larger than 128).
+ */
+template<std::uint_fast8_t CAPACITY>
+class Queue {
+  public:
+    static_assert( CAPACITY >= 2 and CAPACITY <= 128 );
+    static_assert( ( CAPACITY & ( CAPACITY - 1 ) ) == 0 );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Queue() noexcept = default;
+
+    Queue( Queue && ) = delete;
+
+    Queue( Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Queue() noexcept = default;
+
+    auto operator=( Queue && ) = delete;
+
+    auto operator=( Queue const & ) = delete;
+
+    /**
+     * \brief Check if the queue is empty.
+     *
+     * \return true if the queue is empty.
+     * \return false if the queue is not empty.
+     */
+    auto is_empty() const noexcept -> bool
+    {
+        return m_head == m_tail;
+    }
+
+    /**
+     * \brief Post a call to the queue.
+     *
+     * \attention This function must be called from an ISR (or with interrupts disabled).
+     *
+     * \param[in] delegate The call to post.
+     *
+     * \return true if the call was posted.
+     * \return false if the queue was full and the call was dropped.
+     */
+    auto post( Delegate delegate ) noexcept -> bool
+    {
+        auto const head  = m_head;
+        auto const depth = static_cast<std::uint8_t>( head - m_tail );
+
+        if ( depth == CAPACITY ) {
+            if ( m_dropped_calls != 0xFF ) {
+                m_dropped_calls = m_dropped_calls + 1;
+            } // if
+
+            return false;
+        } // if
+
+        m_calls[ head & INDEX_MASK ] = delegate;
+
+        asm volatile( "" ::: "memory" );
+
+        m_head = static_cast<std::uint8_t>( head + 1 );
+
+        if ( depth + 1 > m_maximum_depth ) {
+            m_maximum_depth = depth + 1;
+        } // if
+
+        return true;
+    }
+
+    /**
+     * \brief Call all pending calls (including calls posted while pending calls are
+     *        being called).
+     */
+    void run_pending() noexcept
+    {
+        for ( auto tail = std::uint8_t{ m_tail }; tail != m_head; ) {
+            asm volatile( "" ::: "memory" );
+
+            auto const delegate = m_calls[ tail & INDEX_MASK ];
+
+            asm volatile( "" ::: "memory" );
+
+            m_tail = ++tail;
+
+            delegate();
+        } // for
+    }
+
+    /**
+     * \brief Get the number of calls that have been dropped because the queue was full
+     *        (saturates at 255).
+     *
+     * \return The number of calls that have been dropped because the queue was full.
+     */
+    auto dropped_calls() const noexcept -> std::uint_fast8_t
+    {
+        return m_dropped_calls;
+    }
+
+    /**
+     * \brief Clear the dropped call count.
+     */
+    void clear_dropped_calls() noexcept
+    {
+        m_dropped_calls = 0;
+    }
+
+    /**
+     * \brief Get the maximum number of pending calls the queue has held.
+     *
+     * \return The maximum number of pending calls the queue has held.
+     */
+    auto maximum_depth() const noexcept -> std::uint_fast8_t
+    {
+        return m_maximum_depth;
+    }
+
+    /**
+     * \brief Clear the maximum number of pending calls the queue has held.
+     */
+    void clear_maximum_depth() noexcept
+    {
+        m_maximum_depth = 0;
+    }
+
+  private:
+    /**
+     * \brief Queue index mask.
+     */
+    static constexpr auto INDEX_MASK = std::uint8_t{ CAPACITY - 1 };
+
+    /**
+     * \brief The pending calls.
+     */
+    Delegate m_calls[ CAPACITY ]{};
+
+    /**
+     * \brief The queue's head (write) index (free running, only written by ISRs).
+     */
+    std::uint8_t volatile m_head{};
+
+    /**
+     * \brief The queue's tail (read) index (free running, only written by the main
+     *        context).
+     */
+    std::uint8_t volatile m_tail{};
+
+    /**
+     * \brief The number of calls that have been dropped because the queue was full.
+     */
+    std::uint8_t volatile m_dropped_calls{};
+
+    /**
+     * \brief The maximum number of pending calls the queue has held.
+     */
+    std::uint8_t volatile m_maximum_depth{};
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Deferred_Call
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_DEFERRED_CALL_H
@@ -0,0 +1,1396 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::EEPROM interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_EEPROM_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_EEPROM_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/eeprom.h"
+#include "picolibrary/precondition.h"
+
+/**
+ * \brief Microchip megaAVR EEPROM facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::EEPROM {
+
+/**
+ * \brief EEPROM address.
+ */
+using Address = std::uint16_t;
+
+/**
+ * \brief EEPROM size (bytes).
+ */
+#if defined( __AVR_ATmega328P__ )
+constexpr auto EEPROM_SIZE = Address{ 1024 };
+#elif defined( __AVR_ATmega2560__ )
+constexpr auto EEPROM_SIZE = Address{ 4096 };
+#endif // defined( __AVR_ATmega2560__ )
+
+/**
+ * \brief Get the programming mode (EECR register EEPM field value) that changes an
+ *        EEPROM byte's value with the least amount of work.
+ *
+ * Erasing sets all of a byte's bits, and writing (without erasing) can only clear a
+ * byte's bits, so erase only is used if the desired value is 0xFF, write only is used if
+ * only bits need to be cleared, and erase and write is used otherwise. Erase only and
+ * write only operations take approximately half as long as erase and write operations.
+ *
+ * \param[in] current The byte's current value.
+ * \param[in] desired The byte's desired value.
+ *
+ * \return The programming mode that changes the byte's value with the least amount of
+ *         work.
+ */
+constexpr auto programming_mode( std::uint8_t current, std::uint8_t desired ) noexcept -> std::uint8_t
+{
+    if ( desired == 0xFF ) {
+        return Peripheral::EEPROM::EECR::EEPM_ERASE_ONLY;
+    } // if
+
+    if ( ( current & desired ) == desired ) {
+        return Peripheral::EEPROM::EECR::EEPM_WRITE_ONLY;
+    } // if
+
+    return Peripheral::EEPROM::EECR::EEPM_ERASE_AND_WRITE;
+}
+
+/**
+ * \brief Interrupt driven controller.
+ *
+ * Reads are blocking. Writes are queued and performed by
+ * picolibrary::Microchip::megaAVR::EEPROM::Controller::handle_ready_interrupt() (which
+ * must be called from the EEPROM ready interrupt's ISR), so a write only blocks if the
+ * queue is full. A queued write to an address that already has a queued write replaces
+ * the queued write's data instead of using another queue entry (write coalescing).
+ * Before a byte is programmed its current value is read: unchanged bytes are skipped,
+ * and the cheapest programming mode is used for bytes that do change (see
+ * picolibrary::Microchip::megaAVR::EEPROM::programming_mode()).
+ *
+ * Reads return the data of queued writes, so the EEPROM contents seen through the
+ * controller always reflect all writes that have been made.
+ *
+ * \tparam QUEUE_SIZE The maximum number of writes that can be queued (must be a power
+ *         of two no larger than 128).
+ */
+template<std::uint_fast8_t QUEUE_SIZE>
+class Controller {
+  public:
+    static_assert( QUEUE_SIZE >= 1 and QUEUE_SIZE <= 128 );
+    static_assert( ( QUEUE_SIZE & ( QUEUE_SIZE - 1 ) ) == 0 );
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] eeprom The EEPROM to be used by the controller.
+     */
+    constexpr Controller( Peripheral::EEPROM & eeprom ) noexcept : m_eeprom{ &eeprom }
+    {
+    }
+
+    Controller( Controller && ) = delete;
+
+    Controller( Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Queued writes that have not been performed are discarded.
+     */
+    ~Controller() noexcept
+    {
+        m_eeprom->eecr = 0;
+    }
+
+    auto operator=( Controller && ) = delete;
+
+    auto operator=( Controller const & ) = delete;
+
+    /**
+     * \brief Initialize the controller's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_eeprom->eecr = 0;
+    }
+
+    /**
+     * \brief Read a byte.
+     *
+     * \attention If the byte does not have a queued write, this function blocks until
+     *            programming is complete.
+     *
+     * \pre address < picolibrary::Microchip::megaAVR::EEPROM::EEPROM_SIZE
+     *
+     * \param[in] address The address of the byte to read.
+     *
+     * \return The byte.
+     */
+    auto read( Address address ) const noexcept -> std::uint8_t
+    {
+        PICOLIBRARY_EXPECT( address < EEPROM_SIZE, Generic_Error::OUT_OF_RANGE );
+
+        auto data = std::uint8_t{};
+
+        while ( not try_read( address, data ) ) {} // while
+
+        return data;
+    }
+
+    /**
+     * \brief Read a block of bytes.
+     *
+     * \pre address + ( end - begin ) <= picolibrary::Microchip::megaAVR::EEPROM::EEPROM_SIZE
+     *
+     * \param[in] address The address of the first byte to read.
+     * \param[out] begin The beginning of the data read from the EEPROM.
+     * \param[out] end The end of the data read from the EEPROM.
+     */
+    void read( Address address, std::uint8_t * begin, std::uint8_t * end ) const noexcept
+    {
+        for ( ; begin != end; ++begin, ++address ) {
+            *begin = read( address );
+        } // for
+    }
+
+    /**
+     * \brief Write a byte.
+     *
+     * \attention If the byte does not have a queued write and the queue is full, this
+     *            function blocks until a queue entry becomes available.
+     *
+     * \pre address < picolibrary::Microchip::megaAVR::EEPROM::EEPROM_SIZE
+     *
+     * \param[in] address The address of the byte to write.
+     * \param[in] data The data to write.
+     */
+    void write( Address address, std::uint8_t data ) noexcept
+    {
+        PICOLIBRARY_EXPECT( address < EEPROM_SIZE, Generic_Error::OUT_OF_RANGE );
+
+        while ( not try_write( address, data ) ) {} // while
+    }
+
+    /**
+     * \brief Write a block of bytes.
+     *
+     * \pre address + ( end - begin ) <= picolibrary::Microchip::megaAVR::EEPROM::EEPROM_SIZE
+     *
+     * \param[in] address The address of the first byte to write.
+     * \param[in] begin The beginning of the data to write.
+     * \param[in] end The end of the data to write.
+     */
+    void write( Address address, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    {
+        for ( ; begin != end; ++begin, ++address ) {
+            write( address, *begin );
+        } // for
+    }
+
+    /**
+     * \brief Check if the controller is idle (no writes are queued and programming is
+     *        complete).
+     *
+     * \return true if the controller is idle.
+     * \return false if the controller is not idle.
+     */
+    auto is_idle() const noexcept -> bool
+    {
+        return m_head == m_tail and not( m_eeprom->eecr & Peripheral::EEPROM::EECR::Mask::EEPE );
+    }
+
+    /**
+     * \brief Block until all queued writes have been performed and programming is
+     *        complete.
+     */
+    void flush() const noexcept
+    {
+        while ( not is_idle() ) {} // while
+    }
+
+    /**
+     * \brief Handle an EEPROM ready interrupt.
+     *
+     * \attention This function must be called from the EEPROM ready interrupt's ISR.
+     */
+    void handle_ready_interrupt() noexcept
+    {
+        while ( m_head != m_tail ) {
+            auto const index = m_tail & INDEX_MASK;
+
+            m_tail = static_cast<std::uint8_t>( m_tail + 1 );
+
+            if ( program( m_addresses[ index ], m_data[ index ] ) ) {
+                return;
+            } // if
+        }     // while
+
+        m_eeprom->eecr = 0;
+    }
+
+  private:
+    /**
+     * \brief Queue index mask.
+     */
+    static constexpr auto INDEX_MASK = std::uint8_t{ QUEUE_SIZE - 1 };
+
+    /**
+     * \brief The EEPROM used by the controller.
+     */
+    Peripheral::EEPROM * m_eeprom;
+
+    /**
+     * \brief The addresses of the queued writes.
+     */
+    Address m_addresses[ QUEUE_SIZE ]{};
+
+    /**
+     * \brief The data of the queued writes.
+     */
+    std::uint8_t m_data[ QUEUE_SIZE ]{};
+
+    /**
+     * \brief The queue's head (push) index (free running).
+     */
+    std::uint8_t volatile m_head{};
+
+    /**
+     * \brief The queue's tail (pop) index (free running).
+     */
+    std::uint8_t volatile m_tail{};
+
+    /**
+     * \brief Find the queued write to an address.
+     *
+     * \attention This function must be called with interrupts disabled.
+     *
+     * \param[in] address The address.
+     *
+     * \return The queue entry index (masked) of the queued write if a queued write to
+     *         the address was found.
+     * \return QUEUE_SIZE if a queued write to the address was not found.
+     */
+    auto find( Address address ) const noexcept -> std::uint_fast8_t
+    {
+        for ( auto i = std::uint8_t{ m_tail }; i != m_head; ++i ) {
+            if ( m_addresses[ i & INDEX_MASK ] == address ) {
+                return i & INDEX_MASK;
+            } // if
+        }     // for
+
+        return QUEUE_SIZE;
+    }
+
+    /**
+     * \brief Try to read a byte without waiting for programming to complete.
+     *
+     * \param[in] address The address of the byte to read.
+     * \param[out] data The byte.
+     *
+     * \return true if the byte was read.
+     * \return false if programming must complete before the byte can be read.
+     */
+    auto try_read( Address address, std::uint8_t & data ) const noexcept -> bool
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+        interrupt_controller.disable_interrupt();
+
+        auto const index = find( address );
+        auto const read = index != QUEUE_SIZE
+                          or not( m_eeprom->eecr & Peripheral::EEPROM::EECR::Mask::EEPE );
+
+        if ( index != QUEUE_SIZE ) {
+            data = m_data[ index ];
+        } else if ( read ) {
+            data = read_hardware( address );
+        } // else if
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+
+        return read;
+    }
+
+    /**
+     * \brief Try to queue a write without waiting for a queue entry to become
+     *        available.
+     *
+     * \param[in] address The address of the byte to write.
+     * \param[in] data The data to write.
+     *
+     * \return true if the write was queued.
+     * \return false if the queue is full.
+     */
+    auto try_write( Address address, std::uint8_t data ) noexcept -> bool
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+        interrupt_controller.disable_interrupt();
+
+        auto const queued = enqueue( address, data );
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+
+        return queued;
+    }
+
+    /**
+     * \brief Queue a write (coalescing it with an already queued write to the same
+     *        address if possible).
+     *
+     * \attention This function must be called with interrupts disabled.
+     *
+     * \param[in] address The address of the byte to write.
+     * \param[in] data The data to write.
+     *
+     * \return true if the write was queued.
+     * \return false if the queue is full.
+     */
+    auto enqueue( Address address, std::uint8_t data ) noexcept -> bool
+    {
+        auto const index = find( address );
+
+        if ( index != QUEUE_SIZE ) {
+            m_data[ index ] = data;
+
+            return true;
+        } // if
+
+        if ( static_cast<std::uint8_t>( m_head - m_tail ) == QUEUE_SIZE ) {
+            return false;
+        } // if
+
+        m_addresses[ m_head & INDEX_MASK ] = address;
+        m_data[ m_head & INDEX_MASK ]      = data;
+
+        m_head = static_cast<std::uint8_t>( m_head + 1 );
+
+        m_eeprom->eecr |= Peripheral::EEPROM::EECR::Mask::EERIE;
+
+        return true;
+    }
+
+    /**
+     * \brief Read a byte from the EEPROM.
+     *
+     * \attention This function must be called with interrupts disabled while
+     *            programming is not in progress.
+     *
+     * \param[in] address The address of the byte to read.
+     *
+     * \return The byte.
+     */
+    auto read_hardware( Address address ) const noexcept -> std::uint8_t
+    {
+        m_eeprom->eear = address;
+        m_eeprom->eecr |= Peripheral::EEPROM::EECR::Mask::EERE;
+
+        return m_eeprom->eedr;
+    }
+
+    /**
+     * \brief Program a byte (if its value needs to change).
+     *
+     * \attention This function must be called with interrupts disabled while
+     *            programming is not in progress.
+     *
+     * \param[in] address The address of the byte to program.
+     * \param[in] data The data to program.
+     *
+     * \return true if programming was started.
+     * \return false if the byte already has the desired value.
+     */
+    auto program( Address address, std::uint8_t data ) noexcept -> bool
+    {
+        auto const current = read_hardware( address );
+
+        if ( current == data ) {
+            return false;
+        } // if
+
+        auto const eecr = static_cast<std::uint8_t>(
+            Peripheral::EEPROM::EECR::Mask::EERIE | programming_mode( current, data ) );
+
+        m_eeprom->eedr = data;
+        m_eeprom->eecr = eecr;
+
+        // EEPE must be set no more than 4 clock cycles after EEMPE is set
+        asm volatile(
+            "st %a[eecr], %[eempe]\n\t"
+            "st %a[eecr], %[eepe]"
+            :
+            : [eecr] "e"( &m_eeprom->eecr ),
+              [eempe] "r"( static_cast<std::uint8_t>(
+                  eecr | Peripheral::EEPROM::EECR::Mask::EEMPE ) ),
+              [eepe] "r"( static_cast<std::uint8_t>(
+                  eecr | Peripheral::EEPROM::EECR::Mask::EEMPE
+                  | Peripheral::EEPROM::EECR::Mask::EEPE ) )
+            : "memory" );
+
+        return true;
+    }
+};
+
+/**
+ * \brief Update a CRC-8 (polynomial 0x07, not reflected) with a byte.
+ *
+ * \param[in] crc The CRC to update.
+ * \param[in] data The byte to update the CRC with.
+ *
+ * \return The updated CRC.
+ */
+constexpr auto update_crc8( std::uint8_t crc, std::uint8_t data ) noexcept -> std::uint8_t
+{
+    crc ^= data;
+
+    for ( auto bit = std::uint_fast8_t{}; bit < 8; ++bit ) {
+        crc = crc & 0x80 ? static_cast<std::uint8_t>( ( crc << 1 ) ^ 0x07 )
+                         : static_cast<std::uint8_t>( crc << 1 );
+    } // for
+
+    return crc;
+}
+
+/**
+ * \brief Update a CRC-16 (CCITT polynomial 0x1021, not reflected) with a byte.
+ *
+ * \param[in] crc The CRC to update.
+ * \param[in] data The byte to update the CRC with.
+ *
+ * \return The updated CRC.
+ */
+constexpr auto update_crc16( std::uint16_t crc, std::uint8_t data ) noexcept -> std::uint16_t
+{
+    crc ^= static_cast<std::uint16_t>( data << 8 );
+
+    for ( auto bit = std::uint_fast8_t{}; bit < 8; ++bit ) {
+        crc = crc & 0x8000 ? static_cast<std::uint16_t>( ( crc << 1 ) ^ 0x1021 )
+                           : static_cast<std::uint16_t>( crc << 1 );
+    } // for
+
+    return crc;
+}
+
+/**
+ * \brief Wear leveled circular log.
+ *
+ * The log rotates fixed size records across a region of EEPROM divided into slots so
+ * that each EEPROM cell is only written once every N updates (where N is the number of
+ * slots). Each slot holds a sequence byte, the record, and a CRC-8 of the sequence byte
+ * and the record:
+ *
+ *     | sequence | record (RECORD_SIZE bytes) | CRC-8 |
+ *
+ * Sequence numbers run from 0 to 254 and then wrap (0xFF marks a slot that has never
+ * been written), and each append writes the slot that follows the newest record using
+ * the next sequence number. The newest record is therefore the only valid slot whose
+ * successor is not a valid slot with the next sequence number, so it can be located at
+ * initialization by reading the slots' sequence bytes (and the CRCs of the candidate
+ * slots).
+ *
+ * An append writes one slot: the record and CRC are queued before the sequence byte, so
+ * the sequence byte commits the record. Writes queued before the append are flushed
+ * first, so the sequence byte cannot be coalesced with an earlier queued write to the
+ * same address (which would program it ahead of the record and CRC). If power is lost
+ * during an append, the interrupted slot's CRC does not match and the slot is ignored.
+ *
+ * \tparam Controller The type of EEPROM controller used to access the EEPROM.
+ * \tparam RECORD_SIZE The size of a record (bytes).
+ */
+template<typename Controller, std::uint_fast8_t RECORD_SIZE>
+class Wear_Leveled_Log {
+  public:
+    static_assert( RECORD_SIZE > 0 and RECORD_SIZE <= 253 );
+
+    /**
+     * \brief The size of a slot (bytes).
+     */
+    static constexpr auto SLOT_SIZE = Address{ RECORD_SIZE + 2 };
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] controller The EEPROM controller used to access the EEPROM.
+     * \param[in] begin The address of the beginning of the log's EEPROM region.
+     * \param[in] slots The number of slots in the log's EEPROM region.
+     *
+     * \pre 2 <= slots <= 254
+     * \pre begin + slots * SLOT_SIZE <= picolibrary::Microchip::megaAVR::EEPROM::EEPROM_SIZE
+     */
+    Wear_Leveled_Log( Controller & controller, Address begin, std::uint_fast8_t slots ) noexcept :
+        m_controller{ &controller },
+        m_begin{ begin },
+        m_slots{ static_cast<std::uint8_t>( slots ) }
+    {
+        PICOLIBRARY_EXPECT( slots >= 2 and slots <= 254, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT(
+            begin < EEPROM_SIZE and slots * SLOT_SIZE <= EEPROM_SIZE - begin,
+            Generic_Error::OUT_OF_RANGE );
+    }
+
+    /**
+     * \brief Locate the newest record and count the valid records.
+     *
+     * \attention The EEPROM controller must be initialized before this function is
+     *            called.
+     */
+    void initialize() noexcept
+    {
+        if ( not locate_newest_record() ) {
+            reset();
+
+            return;
+        } // if
+
+        count_records();
+    }
+
+    /**
+     * \brief Erase the log.
+     */
+    void format() noexcept
+    {
+        for ( auto slot = std::uint_fast8_t{}; slot < m_slots; ++slot ) {
+            m_controller->write( slot_address( slot ), EMPTY );
+        } // for
+
+        reset();
+    }
+
+    /**
+     * \brief Check if the log is empty.
+     *
+     * \return true if the log is empty.
+     * \return false if the log is not empty.
+     */
+    constexpr auto is_empty() const noexcept -> bool
+    {
+        return not m_size;
+    }
+
+    /**
+     * \brief Get the number of records in the log.
+     *
+     * \return The number of records in the log.
+     */
+    constexpr auto size() const noexcept -> std::uint_fast8_t
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Read a record.
+     *
+     * \pre age < size()
+     *
+     * \param[in] age The age of the record to read (0 is the newest record).
+     * \param[out] record The location to write the record to (RECORD_SIZE bytes).
+     */
+    void read( std::uint_fast8_t age, std::uint8_t * record ) const noexcept
+    {
+        PICOLIBRARY_EXPECT( age < m_size, Generic_Error::OUT_OF_RANGE );
+
+        auto const address = slot_address( m_newest >= age ? m_newest - age : m_slots + m_newest - age );
+
+        m_controller->read( address + 1, record, record + RECORD_SIZE );
+    }
+
+    /**
+     * \brief Append a record (overwriting the oldest record if all slots are in use).
+     *
+     * \attention If writes are queued, this function blocks until they have been
+     *            performed.
+     *
+     * \param[in] record The record to append (RECORD_SIZE bytes).
+     */
+    void append( std::uint8_t const * record ) noexcept
+    {
+        // the sequence byte must not be coalesced with an earlier queued write
+        m_controller->flush();
+
+        auto const slot     = next_slot( m_newest );
+        auto const sequence = next_sequence( m_sequence );
+        auto const address  = slot_address( slot );
+
+        auto crc = update_crc8( 0, sequence );
+        for ( auto i = std::uint_fast8_t{}; i < RECORD_SIZE; ++i ) {
+            crc = update_crc8( crc, record[ i ] );
+        } // for
+
+        m_controller->write( address + 1, record, record + RECORD_SIZE );
+        m_controller->write( address + 1 + RECORD_SIZE, crc );
+        m_controller->write( address, sequence );
+
+        m_newest   = slot;
+        m_sequence = sequence;
+        m_size     = m_size < m_slots ? m_size + 1 : m_slots;
+    }
+
+  private:
+    /**
+     * \brief The sequence byte value of a slot that has never been written.
+     */
+    static constexpr auto EMPTY = std::uint8_t{ 0xFF };
+
+    /**
+     * \brief The largest sequence number.
+     */
+    static constexpr auto SEQUENCE_MAX = std::uint8_t{ 0xFE };
+
+    /**
+     * \brief The EEPROM controller used to access the EEPROM.
+     */
+    Controller * m_controller;
+
+    /**
+     * \brief The address of the beginning of the log's EEPROM region.
+     */
+    Address m_begin;
+
+    /**
+     * \brief The number of slots in the log's EEPROM region.
+     */
+    std::uint8_t m_slots;
+
+    /**
+     * \brief The slot that holds the newest record.
+     */
+    std::uint8_t m_newest{};
+
+    /**
+     * \brief The sequence number of the newest record.
+     */
+    std::uint8_t m_sequence{};
+
+    /**
+     * \brief The number of records in the log.
+     */
+    std::uint8_t m_size{};
+
+    /**
+     * \brief Get the sequence number that follows a sequence number.
+     *
+     * \param[in] sequence The sequence number.
+     *
+     * \return The sequence number that follows the sequence number.
+     */
+    static constexpr auto next_sequence( std::uint8_t sequence ) noexcept -> std::uint8_t
+    {
+        return sequence < SEQUENCE_MAX ? sequence + 1 : 0;
+    }
+
+    /**
+     * \brief Get the slot that follows a slot.
+     *
+     * \param[in] slot The slot.
+     *
+     * \return The slot that follows the slot.
+     */
+    constexpr auto next_slot( std::uint_fast8_t slot ) const noexcept -> std::uint8_t
+    {
+        return slot + 1 < m_slots ? slot + 1 : 0;
+    }
+
+    /**
+     * \brief Get the address of a slot.
+     *
+     * \param[in] slot The slot.
+     *
+     * \return The address of the slot.
+     */
+    constexpr auto slot_address( std::uint_fast8_t slot ) const noexcept -> Address
+    {
+        return m_begin + slot * SLOT_SIZE;
+    }
+
+    /**
+     * \brief Get a slot's sequence byte.
+     *
+     * \param[in] slot The slot.
+     *
+     * \return The slot's sequence byte.
+     */
+    auto sequence( std::uint_fast8_t slot ) const noexcept -> std::uint8_t
+    {
+        return m_controller->read( slot_address( slot ) );
+    }
+
+    /**
+     * \brief Check if a slot holds a valid record.
+     *
+     * \param[in] slot The slot.
+     *
+     * \return true if the slot holds a valid record.
+     * \return false if the slot does not hold a valid record.
+     */
+    auto is_valid( std::uint_fast8_t slot ) const noexcept -> bool
+    {
+        auto const address = slot_address( slot );
+
+        auto crc = std::uint8_t{};
+        for ( auto i = Address{}; i < RECORD_SIZE + 1; ++i ) {
+            crc = update_crc8( crc, m_controller->read( address + i ) );
+        } // for
+
+        return m_controller->read( address ) != EMPTY
+               and crc == m_controller->read( address + RECORD_SIZE + 1 );
+    }
+
+    /**
+     * \brief Reset the log's state to empty.
+     */
+    void reset() noexcept
+    {
+        m_newest   = m_slots - 1;
+        m_sequence = SEQUENCE_MAX;
+        m_size     = 0;
+    }
+
+    /**
+     * \brief Locate the newest record.
+     *
+     * \return true if the newest record was located.
+     * \return false if the log is empty.
+     */
+    auto locate_newest_record() noexcept -> bool
+    {
+        for ( auto slot = std::uint_fast8_t{}; slot < m_slots; ++slot ) {
+            auto const slot_sequence = sequence( slot );
+            auto const successor     = next_slot( slot );
+
+            if ( slot_sequence != EMPTY and is_valid( slot )
+                 and not( sequence( successor ) == next_sequence( slot_sequence ) and is_valid( successor ) ) ) {
+                m_newest   = slot;
+                m_sequence = slot_sequence;
+
+                return true;
+            } // if
+        }     // for
+
+        return false;
+    }
+
+    /**
+     * \brief Count the valid records (from the newest record back).
+     */
+    void count_records() noexcept
+    {
+        m_size = 1;
+
+        for ( auto slot = m_newest, slot_sequence = m_sequence; m_size < m_slots; ++m_size ) {
+            slot          = slot ? slot - 1 : m_slots - 1;
+            slot_sequence = slot_sequence ? slot_sequence - 1 : SEQUENCE_MAX;
+
+            if ( sequence( slot ) != slot_sequence or not is_valid( slot ) ) {
+                return;
+            } // if
+        } // for
+    }
+};
+
+/**
+ * \brief Wear leveled value.
+ *
+ * The value is cached in RAM (reads never access the EEPROM) and each store appends the
+ * value to a picolibrary::Microchip::megaAVR::EEPROM::Wear_Leveled_Log. This is suitable
+ * for values that change frequently, such as event counters.
+ *
+ * \tparam Controller The type of EEPROM controller used to access the EEPROM.
+ * \tparam T The value's type (must be trivially copyable).
+ */
+template<typename Controller, typename T>
+class Wear_Leveled_Value {
+  public:
+    static_assert( std::is_trivially_copyable_v<T> );
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] controller The EEPROM controller used to access the EEPROM.
+     * \param[in] begin The address of the beginning of the value's EEPROM region.
+     * \param[in] slots The number of slots in the value's EEPROM region.
+     */
+    Wear_Leveled_Value( Controller & controller, Address begin, std::uint_fast8_t slots ) noexcept :
+        m_log{ controller, begin, slots }
+    {
+    }
+
+    /**
+     * \brief Load the value from the EEPROM.
+     *
+     * \attention The EEPROM controller must be initialized before this function is
+     *            called.
+     *
+     * \param[in] default_value The value to use if a value has never been stored.
+     */
+    void initialize( T const & default_value ) noexcept
+    {
+        m_log.initialize();
+
+        if ( m_log.is_empty() ) {
+            m_value = default_value;
+
+            return;
+        } // if
+
+        m_log.read( 0, reinterpret_cast<std::uint8_t *>( &m_value ) );
+    }
+
+    /**
+     * \brief Get the value.
+     *
+     * \return The value.
+     */
+    constexpr auto value() const noexcept -> T const &
+    {
+        return m_value;
+    }
+
+    /**
+     * \brief Store a value.
+     *
+     * \param[in] value The value to store.
+     */
+    void store( T const & value ) noexcept
+    {
+        m_value = value;
+
+        m_log.append( reinterpret_cast<std::uint8_t const *>( &m_value ) );
+    }
+
+  private:
+    /**
+     * \brief The log that holds the value's history.
+     */
+    Wear_Leveled_Log<Controller, sizeof( T )> m_log;
+
+    /**
+     * \brief The value.
+     */
+    T m_value{};
+};
+
+/**
+ * \brief Crash safe, transactional key/value store.
+ *
+ * The store's EEPROM region is split into two banks. Each bank holds a header followed
+ * by the store's records:
+ *
+ *     | generation (2) | records size (2) | CRC-16 (2) | records (records size bytes) |
+ *
+ * Each record is a key, a value size, and a value. The CRC-16 covers the generation, the
+ * records size, and the records. Every update writes a complete copy of the store (with
+ * the update applied and the generation incremented) to the inactive bank, which then
+ * becomes the active bank. The previously active bank is not touched, so if power is lost
+ * during an update, the updated bank's CRC does not match and the previous contents of
+ * the store are used. Since the EEPROM controller skips bytes whose value does not
+ * change, only the bytes that differ between the banks are programmed.
+ *
+ * The banks are validated and the active bank's records are indexed in RAM once at
+ * initialization, so locating a key never requires reading the EEPROM.
+ *
+ * \tparam Controller The type of EEPROM controller used to access the EEPROM.
+ * \tparam CAPACITY The maximum number of keys the store can hold.
+ */
+template<typename Controller, std::uint_fast8_t CAPACITY>
+class Key_Value_Store {
+  public:
+    static_assert( CAPACITY > 0 );
+
+    /**
+     * \brief Key.
+     */
+    using Key = std::uint8_t;
+
+    /**
+     * \brief The size of a bank header (bytes).
+     */
+    static constexpr auto HEADER_SIZE = Address{ 6 };
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] controller The EEPROM controller used to access the EEPROM.
+     * \param[in] begin The address of the beginning of the store's EEPROM region.
+     * \param[in] bank_size The size of each of the store's two banks (bytes).
+     *
+     * \pre HEADER_SIZE < bank_size
+     * \pre begin + 2 * bank_size <= picolibrary::Microchip::megaAVR::EEPROM::EEPROM_SIZE
+     */
+    Key_Value_Store( Controller & controller, Address begin, Address bank_size ) noexcept :
+        m_controller{ &controller },
+        m_begin{ begin },
+        m_bank_size{ bank_size }
+    {
+        PICOLIBRARY_EXPECT( bank_size > HEADER_SIZE, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT(
+            begin < EEPROM_SIZE and bank_size <= ( EEPROM_SIZE - begin ) / 2,
+            Generic_Error::OUT_OF_RANGE );
+    }
+
+    /**
+     * \brief Select the active bank and index its records.
+     *
+     * \attention The EEPROM controller must be initialized before this function is
+     *            called.
+     *
+     * \return true if a valid bank was found.
+     * \return false if a valid bank was not found (the store is empty).
+     */
+    auto initialize() noexcept -> bool
+    {
+        auto const bank_0_is_valid = load( 0 );
+        auto const generation_0    = m_generation;
+
+        if ( load( 1 ) and ( not bank_0_is_valid or is_newer( m_generation, generation_0 ) ) ) {
+            return true;
+        } // if
+
+        if ( bank_0_is_valid ) {
+            return load( 0 );
+        } // if
+
+        m_active     = 1;
+        m_generation = 0;
+        m_size       = 0;
+        m_used       = 0;
+
+        return false;
+    }
+
+    /**
+     * \brief Check if the store contains a key.
+     *
+     * \param[in] key The key.
+     *
+     * \return true if the store contains the key.
+     * \return false if the store does not contain the key.
+     */
+    auto contains( Key key ) const noexcept -> bool
+    {
+        return find( key ) != CAPACITY;
+    }
+
+    /**
+     * \brief Get the size of a key's value.
+     *
+     * \pre the store contains the key
+     *
+     * \param[in] key The key.
+     *
+     * \return The size of the key's value.
+     */
+    auto size( Key key ) const noexcept -> std::uint_fast8_t
+    {
+        auto const entry = find( key );
+
+        PICOLIBRARY_EXPECT( entry != CAPACITY, Generic_Error::INVALID_ARGUMENT );
+
+        return m_index[ entry ].size;
+    }
+
+    /**
+     * \brief Read a key's value.
+     *
+     * \pre the store contains the key
+     *
+     * \param[in] key The key.
+     * \param[out] value The location to write the key's value to (size( key ) bytes).
+     */
+    void read( Key key, std::uint8_t * value ) const noexcept
+    {
+        auto const entry = find( key );
+
+        PICOLIBRARY_EXPECT( entry != CAPACITY, Generic_Error::INVALID_ARGUMENT );
+
+        auto const address = bank_address( m_active ) + m_index[ entry ].offset;
+
+        m_controller->read( address, value, value + m_index[ entry ].size );
+    }
+
+    /**
+     * \brief Set a key's value (atomically).
+     *
+     * \attention The update is durable once the EEPROM controller is idle.
+     *
+     * \pre the store has room for the key and value
+     *
+     * \param[in] key The key.
+     * \param[in] begin The beginning of the key's value.
+     * \param[in] end The end of the key's value.
+     */
+    void set( Key key, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    {
+        PICOLIBRARY_EXPECT( end - begin <= 0xFF, Generic_Error::INVALID_ARGUMENT );
+
+        auto const size  = static_cast<std::uint8_t>( end - begin );
+        auto const entry = find( key );
+        auto const used  = m_used + 2 + size - ( entry != CAPACITY ? 2 + m_index[ entry ].size : 0 );
+
+        PICOLIBRARY_EXPECT(
+            ( entry != CAPACITY or m_size < CAPACITY ) and used <= m_bank_size - HEADER_SIZE,
+            Generic_Error::INSUFFICIENT_CAPACITY );
+
+        commit( key, begin, size, true );
+    }
+
+    /**
+     * \brief Remove a key (atomically).
+     *
+     * \attention The update is durable once the EEPROM controller is idle.
+     *
+     * \param[in] key The key.
+     */
+    void erase( Key key ) noexcept
+    {
+        if ( contains( key ) ) {
+            commit( key, nullptr, 0, false );
+        } // if
+    }
+
+  private:
+    /**
+     * \brief RAM index entry.
+     */
+    struct Entry {
+        /**
+         * \brief The key.
+         */
+        Key key;
+
+        /**
+         * \brief The size of the key's value.
+         */
+        std::uint8_t size;
+
+        /**
+         * \brief The offset of the key's value from the beginning of the bank.
+         */
+        Address offset;
+    };
+
+    /**
+     * \brief The EEPROM controller used to access the EEPROM.
+     */
+    Controller * m_controller;
+
+    /**
+     * \brief The address of the beginning of the store's EEPROM region.
+     */
+    Address m_begin;
+
+    /**
+     * \brief The size of each of the store's two banks.
+     */
+    Address m_bank_size;
+
+    /**
+     * \brief The active bank.
+     */
+    std::uint8_t m_active{ 1 };
+
+    /**
+     * \brief The active bank's generation.
+     */
+    std::uint16_t m_generation{};
+
+    /**
+     * \brief The number of keys in the store.
+     */
+    std::uint8_t m_size{};
+
+    /**
+     * \brief The size of the active bank's records.
+     */
+    Address m_used{};
+
+    /**
+     * \brief The RAM index of the active bank's records.
+     */
+    Entry m_index[ CAPACITY ]{};
+
+    /**
+     * \brief Check if a generation is newer than another generation.
+     *
+     * \param[in] a The generation to check.
+     * \param[in] b The generation to check against.
+     *
+     * \return true if a is newer than b.
+     * \return false if a is not newer than b.
+     */
+    static constexpr auto is_newer( std::uint16_t a, std::uint16_t b ) noexcept -> bool
+    {
+        return a != b and static_cast<std::uint16_t>( a - b ) < 0x8000;
+    }
+
+    /**
+     * \brief Get the address of a bank.
+     *
+     * \param[in] bank The bank.
+     *
+     * \return The address of the bank.
+     */
+    constexpr auto bank_address( std::uint_fast8_t bank ) const noexcept -> Address
+    {
+        return m_begin + ( bank ? m_bank_size : 0 );
+    }
+
+    /**
+     * \brief Read a little endian 16-bit value.
+     *
+     * \param[in] address The address of the value.
+     *
+     * \return The value.
+     */
+    auto read_16( Address address ) const noexcept -> std::uint16_t
+    {
+        return m_controller->read( address ) | ( m_controller->read( address + 1 ) << 8 );
+    }
+
+    /**
+     * \brief Find a key's RAM index entry.
+     *
+     * \param[in] key The key.
+     *
+     * \return The key's RAM index entry if the store contains the key.
+     * \return CAPACITY if the store does not contain the key.
+     */
+    auto find( Key key ) const noexcept -> std::uint_fast8_t
+    {
+        for ( auto entry = std::uint_fast8_t{}; entry < m_size; ++entry ) {
+            if ( m_index[ entry ].key == key ) {
+                return entry;
+            } // if
+        }     // for
+
+        return CAPACITY;
+    }
+
+    /**
+     * \brief Validate a bank and, if it is valid, make it the active bank and index its
+     *        records.
+     *
+     * \param[in] bank The bank.
+     *
+     * \return true if the bank is valid.
+     * \return false if the bank is not valid.
+     */
+    auto load( std::uint_fast8_t bank ) noexcept -> bool
+    {
+        auto const address = bank_address( bank );
+        auto const used    = read_16( address + 2 );
+
+        if ( used > m_bank_size - HEADER_SIZE ) {
+            return false;
+        } // if
+
+        auto crc = std::uint16_t{ 0xFFFF };
+        for ( auto offset = Address{}; offset < 4; ++offset ) {
+            crc = update_crc16( crc, m_controller->read( address + offset ) );
+        } // for
+        for ( auto offset = HEADER_SIZE; offset < HEADER_SIZE + used; ++offset ) {
+            crc = update_crc16( crc, m_controller->read( address + offset ) );
+        } // for
+
+        if ( crc != read_16( address + 4 ) or not index( bank, used ) ) {
+            return false;
+        } // if
+
+        m_active     = bank;
+        m_generation = read_16( address );
+        m_used       = used;
+
+        return true;
+    }
+
+    /**
+     * \brief Index a bank's records.
+     *
+     * \param[in] bank The bank.
+     * \param[in] used The size of the bank's records.
+     *
+     * \return true if the bank's records were indexed.
+     * \return false if the bank's records are malformed or there are too many of them.
+     */
+    auto index( std::uint_fast8_t bank, Address used ) noexcept -> bool
+    {
+        auto const address = bank_address( bank );
+
+        m_size = 0;
+
+        for ( auto offset = HEADER_SIZE; offset < HEADER_SIZE + used; ++m_size ) {
+            if ( m_size == CAPACITY or HEADER_SIZE + used - offset < 2 ) {
+                return false;
+            } // if
+
+            m_index[ m_size ] = Entry{ m_controller->read( address + offset ),
+                                       m_controller->read( address + offset + 1 ),
+                                       static_cast<Address>( offset + 2 ) };
+
+            offset += 2 + m_index[ m_size ].size;
+        } // for
+
+        return true;
+    }
+
+    /**
+     * \brief Write a byte to the inactive bank and update the bank's CRC.
+     *
+     * \param[in] address The address to write the byte to.
+     * \param[in] data The byte.
+     * \param[in,out] crc The bank's CRC.
+     */
+    void write( Address address, std::uint8_t data, std::uint16_t & crc ) noexcept
+    {
+        m_controller->write( address, data );
+
+        crc = update_crc16( crc, data );
+    }
+
+    /**
+     * \brief Write the store (with a key's value set or the key removed) to the inactive
+     *        bank and make it the active bank.
+     *
+     * \param[in] key The key.
+     * \param[in] value The key's value (ignored if the key is being removed).
+     * \param[in] size The size of the key's value (ignored if the key is being removed).
+     * \param[in] set true to set the key's value, false to remove the key.
+     */
+    void commit( Key key, std::uint8_t const * value, std::uint8_t size, bool set ) noexcept
+    {
+        auto const entry = find( key );
+        auto const used  = static_cast<Address>(
+            m_used - ( entry != CAPACITY ? 2 + m_index[ entry ].size : 0 ) + ( set ? 2 + size : 0 ) );
+        auto const generation = static_cast<std::uint16_t>( m_generation + 1 );
+
+        auto crc = update_crc16(
+            update_crc16(
+                update_crc16( update_crc16( 0xFFFF, generation & 0xFF ), generation >> 8 ), used & 0xFF ),
+            used >> 8 );
+
+        auto offset = copy_records( key, crc );
+
+        if ( set ) {
+            append_record( key, value, size, offset, crc );
+        } // if
+
+        write_header( generation, used, crc );
+
+        m_active ^= 1;
+        m_generation = generation;
+        m_used       = used;
+    }
+
+    /**
+     * \brief Copy the active bank's records (except a key's record) to the inactive bank
+     *        and update the RAM index to refer to the copies.
+     *
+     * \param[in] key The key whose record is not copied.
+     * \param[in,out] crc The inactive bank's CRC.
+     *
+     * \return The offset that follows the copied records.
+     */
+    auto copy_records( Key key, std::uint16_t & crc ) noexcept -> Address
+    {
+        auto const source = bank_address( m_active );
+        auto const target = bank_address( m_active ^ 1 );
+
+        auto offset = HEADER_SIZE;
+        auto size   = std::uint8_t{};
+
+        for ( auto entry = std::uint_fast8_t{}; entry < m_size; ++entry ) {
+            auto const record = m_index[ entry ];
+
+            if ( record.key != key ) {
+                write( target + offset, record.key, crc );
+                write( target + offset + 1, record.size, crc );
+                for ( auto i = std::uint_fast8_t{}; i < record.size; ++i ) {
+                    write( target + offset + 2 + i, m_controller->read( source + record.offset + i ), crc );
+                } // for
+
+                m_index[ size++ ] = Entry{ record.key, record.size, static_cast<Address>( offset + 2 ) };
+                offset += 2 + record.size;
+            } // if
+        }     // for
+
+        m_size = size;
+
+        return offset;
+    }
+
+    /**
+     * \brief Append a record to the inactive bank and add it to the RAM index.
+     *
+     * \param[in] key The record's key.
+     * \param[in] value The record's value.
+     * \param[in] size The size of the record's value.
+     * \param[in] offset The offset to write the record to.
+     * \param[in,out] crc The inactive bank's CRC.
+     */
+    void append_record(
+        Key                  key,
+        std::uint8_t const * value,
+        std::uint8_t         size,
+        Address              offset,
+        std::uint16_t &      crc ) noexcept
+    {
+        auto const target = bank_address( m_active ^ 1 );
+
+        write( target + offset, key, crc );
+        write( target + offset + 1, size, crc );
+        for ( auto i = std::uint_fast8_t{}; i < size; ++i ) {
+            write( target + offset + 2 + i, value[ i ], crc );
+        } // for
+
+        m_index[ m_size++ ] = Entry{ key, size, static_cast<Address>( offset + 2 ) };
+    }
+
+    /**
+     * \brief Write the inactive bank's header.
+     *
+     * \param[in] generation The inactive bank's generation.
+     * \param[in] used The size of the inactive bank's records.
+     * \param[in] crc The inactive bank's CRC.
+     */
+    void write_header( std::uint16_t generation, Address used, std::uint16_t crc ) noexcept
+    {
+        auto const target = bank_address( m_active ^ 1 );
+
+        std::uint8_t const header[] = {
+            static_cast<std::uint8_t>( generation ), static_cast<std::uint8_t>( generation >> 8 ),
+            static_cast<std::uint8_t>( used ),       static_cast<std::uint8_t>( used >> 8 ),
+            static_cast<std::uint8_t>( crc ),        static_cast<std::uint8_t>( crc >> 8 ),
+        };
+
+        m_controller->write( target, header, header + sizeof( header ) );
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::EEPROM
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_EEPROM_H
@@ -0,0 +1,373 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Flash interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_FLASH_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_FLASH_H
+
+#include <avr-libcpp/pgmspace>
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+#include "picolibrary/precondition.h"
+
+/**
+ * \brief Microchip megaAVR flash facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Flash {
+
+#if defined( __AVR_ATmega328P__ )
+/**
+ * \brief Flash address (bytes).
+ */
+using Address = std::uint16_t;
+
+/**
+ * \brief Flash size (bytes).
+ */
+constexpr auto FLASH_SIZE = std::uint32_t{ 32768 };
+
+/**
+ * \brief Flash page size (bytes).
+ */
+constexpr auto PAGE_SIZE = std::uint_fast16_t{ 128 };
+#elif defined( __AVR_ATmega2560__ )
+/**
+ * \brief Flash address (bytes).
+ */
+using Address = std::uint32_t;
+
+/**
+ * \brief Flash size (bytes).
+ */
+constexpr auto FLASH_SIZE = std::uint32_t{ 262144 };
+
+/**
+ * \brief Flash page size (bytes).
+ */
+constexpr auto PAGE_SIZE = std::uint_fast16_t{ 256 };
+#endif // defined( __AVR_ATmega2560__ )
+
+/**
+ * \brief Flash self-programming (SPM) page writer.
+ *
+ * Pages are programmed using
+ * picolibrary::Microchip::megaAVR::Flash::Writer::program(), which loads the page's data
+ * into the SPM page buffer and starts erasing the page. The page erase, the page write,
+ * and re-enabling the Read-While-Write (RWW) section are advanced by
+ * picolibrary::Microchip::megaAVR::Flash::Writer::service(), which never blocks, so the
+ * next page can be received while the current page is being programmed. Since the page's
+ * data is copied into the SPM page buffer before
+ * picolibrary::Microchip::megaAVR::Flash::Writer::program() returns, the RAM buffer
+ * holding the page can be reused immediately.
+ *
+ * \attention The writer must be executed from the boot loader section (the SPM
+ *            instruction has no effect when executed from the application section). While
+ *            a page in the RWW section is being programmed, the RWW section cannot be
+ *            read, so interrupt vectors must be moved to the boot loader section (or
+ *            interrupts disabled) during programming.
+ * \attention The SPM instruction cannot be executed while an EEPROM write is in progress.
+ */
+class Writer {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Writer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] cpu The CPU to be used by the writer.
+     */
+    constexpr Writer( Peripheral::CPU & cpu ) noexcept : m_cpu{ &cpu }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Writer( Writer && source ) noexcept :
+        m_cpu{ source.m_cpu },
+        m_state{ source.m_state },
+        m_page{ source.m_page }
+    {
+        source.m_cpu = nullptr;
+    }
+
+    Writer( Writer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention If a page is being programmed, the destructor blocks until programming is
+     *            complete.
+     */
+    ~Writer() noexcept
+    {
+        finish();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Writer && expression ) noexcept -> Writer &
+    {
+        if ( &expression != this ) {
+            finish();
+
+            m_cpu   = expression.m_cpu;
+            m_state = expression.m_state;
+            m_page  = expression.m_page;
+
+            expression.m_cpu = nullptr;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Writer const & ) = delete;
+
+    /**
+     * \brief Check if the writer is idle (no page is being programmed).
+     *
+     * \return true if the writer is idle.
+     * \return false if the writer is not idle.
+     */
+    constexpr auto is_idle() const noexcept -> bool
+    {
+        return m_state == State::IDLE;
+    }
+
+    /**
+     * \brief Start programming a page.
+     *
+     * \pre picolibrary::Microchip::megaAVR::Flash::Writer::is_idle()
+     * \pre page < picolibrary::Microchip::megaAVR::Flash::FLASH_SIZE
+     * \pre page % picolibrary::Microchip::megaAVR::Flash::PAGE_SIZE == 0
+     *
+     * \param[in] page The address of the page to program.
+     * \param[in] data The page's data (picolibrary::Microchip::megaAVR::Flash::PAGE_SIZE
+     *            bytes).
+     */
+    void program( Address page, std::uint8_t const * data ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_idle(), Generic_Error::LOGIC_ERROR );
+        PICOLIBRARY_EXPECT( page < FLASH_SIZE, Generic_Error::OUT_OF_RANGE );
+        PICOLIBRARY_EXPECT( page % PAGE_SIZE == 0, Generic_Error::INVALID_ARGUMENT );
+
+        wait_for_spm();
+
+        for ( auto offset = std::uint_fast16_t{}; offset < PAGE_SIZE; offset += 2 ) {
+            fill( offset, data[ offset ] | ( data[ offset + 1 ] << 8 ) );
+        } // for
+
+        m_page  = page;
+        m_state = State::ERASING;
+
+        execute( Peripheral::CPU::SPMCSR::Mask::PGERS | Peripheral::CPU::SPMCSR::Mask::SPMEN );
+    }
+
+    /**
+     * \brief Advance page programming without blocking.
+     *
+     * \attention This function must be called periodically (e.g. while receiving the next
+     *            page) until picolibrary::Microchip::megaAVR::Flash::Writer::is_idle()
+     *            returns true.
+     */
+    void service() noexcept
+    {
+        if ( is_idle() or spm_is_busy() ) {
+            return;
+        } // if
+
+        if ( m_state == State::ERASING ) {
+            m_state = State::WRITING;
+
+            execute( Peripheral::CPU::SPMCSR::Mask::PGWRT | Peripheral::CPU::SPMCSR::Mask::SPMEN );
+
+            return;
+        } // if
+
+        m_state = State::IDLE;
+
+        execute( Peripheral::CPU::SPMCSR::Mask::RWWSRE | Peripheral::CPU::SPMCSR::Mask::SPMEN );
+    }
+
+    /**
+     * \brief Block until page programming is complete.
+     */
+    void flush() noexcept
+    {
+        while ( not is_idle() ) { service(); } // while
+
+        wait_for_spm();
+    }
+
+    /**
+     * \brief Read a byte from flash.
+     *
+     * \pre address < picolibrary::Microchip::megaAVR::Flash::FLASH_SIZE
+     *
+     * \param[in] address The address of the byte to read.
+     *
+     * \return The byte.
+     */
+    auto read( Address address ) noexcept -> std::uint8_t
+    {
+        PICOLIBRARY_EXPECT( address < FLASH_SIZE, Generic_Error::OUT_OF_RANGE );
+
+        flush();
+
+#if defined( __AVR_ATmega2560__ )
+        return pgm_read_byte_far( address );
+#else  // defined( __AVR_ATmega2560__ )
+        return pgm_read_byte( reinterpret_cast<char const *>( address ) );
+#endif // defined( __AVR_ATmega2560__ )
+    }
+
+  private:
+    /**
+     * \brief Writer state.
+     */
+    enum class State : std::uint_fast8_t {
+        IDLE,    ///< Idle.
+        ERASING, ///< Erasing a page.
+        WRITING, ///< Writing a page.
+    };
+
+    /**
+     * \brief The CPU used by the writer.
+     */
+    Peripheral::CPU * m_cpu{};
+
+    /**
+     * \brief The writer's state.
+     */
+    State m_state{ State::IDLE };
+
+    /**
+     * \brief The address of the page being programmed.
+     */
+    Address m_page{};
+
+    /**
+     * \brief Finish programming the page being programmed (if any).
+     */
+    void finish() noexcept
+    {
+        if ( m_cpu ) {
+            flush();
+        } // if
+    }
+
+    /**
+     * \brief Check if an SPM operation is in progress.
+     *
+     * \return true if an SPM operation is in progress.
+     * \return false if an SPM operation is not in progress.
+     */
+    auto spm_is_busy() const noexcept -> bool
+    {
+        return m_cpu->spmcsr & Peripheral::CPU::SPMCSR::Mask::SPMEN;
+    }
+
+    /**
+     * \brief Block until the in progress SPM operation (if any) is complete.
+     */
+    void wait_for_spm() const noexcept
+    {
+        while ( spm_is_busy() ) {} // while
+    }
+
+    /**
+     * \brief Load a word into the SPM page buffer.
+     *
+     * \param[in] offset The offset of the word within the page.
+     * \param[in] word The word to load.
+     */
+    void fill( std::uint16_t offset, std::uint16_t word ) noexcept
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+        interrupt_controller.disable_interrupt();
+
+        // SPMCSR must be written no more than 4 clock cycles before the SPM instruction is
+        // executed, and the word is passed to the SPM instruction in r1:r0
+        asm volatile(
+            "movw r0, %[word]\n\t"
+            "st %a[spmcsr], %[command]\n\t"
+            "spm\n\t"
+            "clr __zero_reg__"
+            :
+            : [spmcsr] "x"( &m_cpu->spmcsr ),
+              [command] "r"( Peripheral::CPU::SPMCSR::Mask::SPMEN ),
+              [word] "r"( word ),
+              [z] "z"( offset )
+            : "r0", "memory" );
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+    }
+
+    /**
+     * \brief Execute a page erase, page write, or RWW section read enable SPM operation
+     *        on the page being programmed.
+     *
+     * \param[in] command The SPM operation's SPMCSR register value.
+     */
+    void execute( std::uint8_t command ) noexcept
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+        interrupt_controller.disable_interrupt();
+
+#if defined( __AVR_ATmega2560__ )
+        m_cpu->rampz = m_page >> 16;
+#endif // defined( __AVR_ATmega2560__ )
+
+        // SPMCSR must be written no more than 4 clock cycles before the SPM instruction is
+        // executed
+        asm volatile(
+            "st %a[spmcsr], %[command]\n\t"
+            "spm"
+            :
+            : [spmcsr] "x"( &m_cpu->spmcsr ),
+              [command] "r"( command ),
+              [z] "z"( static_cast<std::uint16_t>( m_page ) )
+            : "memory" );
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Flash
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_FLASH_H
@@ -28,6 +28,7 @@
 
 #include "picolibrary/gpio.h"
 #include "picolibrary/microchip/megaavr/peripheral/port.h"
+#include "picolibrary/utility.h"
 
 /**
  * \brief Microchip megaAVR GPIO facilities.
@@ -259,40 +260,387 @@ class Pin {
     std::uint8_t m_mask{};
 };
 
+/**
+ * \brief GPIO port index.
+ */
+enum class Port : std::uint8_t {
+#if defined( __AVR_ATmega328P__ )
+    B = 1, ///< PORTB.
+    C = 2, ///< PORTC.
+    D = 3, ///< PORTD.
+#elif defined( __AVR_ATmega2560__ )
+    A = 0,  ///< PORTA.
+    B = 1,  ///< PORTB.
+    C = 2,  ///< PORTC.
+    D = 3,  ///< PORTD.
+    E = 4,  ///< PORTE.
+    F = 5,  ///< PORTF.
+    G = 6,  ///< PORTG.
+    H = 7,  ///< PORTH.
+    J = 8,  ///< PORTJ.
+    K = 9,  ///< PORTK.
+    L = 10, ///< PORTL.
+#endif // defined( __AVR_ATmega2560__ )
+};
+
+/**
+ * \brief Get the address of a GPIO port.
+ *
+ * GPIO ports are located at a fixed 3 byte stride in two banks (PORTA-PORTG starting
+ * at 0x0020, PORTH-PORTL starting at 0x0100), so the address is computed instead of
+ * looked up in a table (a table indexed at run time would occupy SRAM).
+ *
+ * \param[in] port The GPIO port.
+ *
+ * \return The address of the GPIO port.
+ */
+constexpr auto port_address( Port port ) noexcept -> std::uint16_t
+{
+    auto const index = to_underlying( port );
+
+#if defined( __AVR_ATmega2560__ )
+    if ( index >= to_underlying( Port::H ) ) {
+        return 0x0100 + 3 * ( index - to_underlying( Port::H ) );
+    } // if
+#endif // defined( __AVR_ATmega2560__ )
+
+    return 0x0020 + 3 * index;
+}
+
+/**
+ * \brief Get the index of a GPIO port.
+ *
+ * \param[in] address The address of the GPIO port.
+ *
+ * \return The index of the GPIO port.
+ */
+constexpr auto port_index( std::uintptr_t address ) noexcept -> Port
+{
+#if defined( __AVR_ATmega2560__ )
+    if ( address >= 0x0100 ) {
+        return static_cast<Port>( to_underlying( Port::H ) + ( address - 0x0100 ) / 3 );
+    } // if
+#endif // defined( __AVR_ATmega2560__ )
+
+    return static_cast<Port>( ( address - 0x0020 ) / 3 );
+}
+
+/**
+ * \brief Compact pin.
+ *
+ * picolibrary::Microchip::megaAVR::GPIO::Compact_Pin provides the same operations as
+ * picolibrary::Microchip::megaAVR::GPIO::Pin, but stores the GPIO port index and the
+ * pin's bit number in a single byte instead of a GPIO port pointer and a mask (3 bytes).
+ * The GPIO port address and the mask are decoded each time the pin is accessed. If the
+ * pin is known at compile time, decoding is done at compile time.
+ *
+ * The compact pin wrappers (e.g.
+ * picolibrary::Microchip::megaAVR::GPIO::Compact_Push_Pull_IO_Pin) use a compact pin.
+ *
+ * \attention A compact pin identifies a single bit. Multi-bit masks (e.g. the combined
+ *            SCK and MOSI pins used by the SPI based SPI controllers) are not supported,
+ *            and require picolibrary::Microchip::megaAVR::GPIO::Pin.
+ */
+class Compact_Pin {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Compact_Pin() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] port The GPIO port the pin is a member of.
+     * \param[in] bit The pin's bit number.
+     */
+    constexpr Compact_Pin( Port port, std::uint_fast8_t bit ) noexcept :
+        m_pin{ static_cast<std::uint8_t>(
+            ( ( to_underlying( port ) + 1 ) << PORT_OFFSET ) | ( bit & BIT_MASK ) ) }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Compact_Pin( Compact_Pin && source ) noexcept : m_pin{ source.m_pin }
+    {
+        source.m_pin = 0;
+    }
+
+    Compact_Pin( Compact_Pin const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Compact_Pin() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Compact_Pin && expression ) noexcept -> Compact_Pin &
+    {
+        if ( &expression != this ) {
+            m_pin = expression.m_pin;
+
+            expression.m_pin = 0;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Compact_Pin const & ) = delete;
+
+    /**
+     * \brief Check if the pin is associated with a GPIO port.
+     *
+     * \return true if the pin is associated with a GPIO port.
+     * \return false if the pin is not associated with a GPIO port.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return m_pin;
+    }
+
+    /**
+     * \brief Configure the pin to act as an internally pulled-up input.
+     */
+    void configure_pin_as_internally_pulled_up_input() noexcept
+    {
+        port().ddr &= ~mask();
+    }
+
+    /**
+     * \brief Configure the pin to act as an open-drain I/O pin.
+     */
+    void configure_pin_as_open_drain_io() noexcept
+    {
+        port().port &= ~mask();
+    }
+
+    /**
+     * \brief Configure the pin to act as a push-pull I/O pin.
+     */
+    void configure_pin_as_push_pull_io() noexcept
+    {
+        port().ddr |= mask();
+    }
+
+    /**
+     * \brief Check if an internally pulled-up input pin's internal pull up resistor is
+     *        disabled.
+     *
+     * \return true if the internally pulled-up input pin's internal pull-up resistor is
+     *         disabled.
+     * \return false if the internally pulled-up input pin's internal pull-up resistor is
+     *         not disabled.
+     */
+    auto pull_up_is_disabled() const noexcept -> bool
+    {
+        return not pull_up_is_enabled();
+    }
+
+    /**
+     * \brief Check if an internally pulled-up input pin's internal pull up resistor is
+     *        enabled.
+     *
+     * \return true if the internally pulled-up input pin's internal pull-up resistor is
+     *         enabled.
+     * \return false if the internally pulled-up input pin's internal pull-up resistor is
+     *         not enabled.
+     */
+    auto pull_up_is_enabled() const noexcept -> bool
+    {
+        return port().port & mask();
+    }
+
+    /**
+     * \brief Disable an internally pulled-up input pin's internal pull-up resistor.
+     */
+    void disable_pull_up() noexcept
+    {
+        port().port &= ~mask();
+    }
+
+    /**
+     * \brief Enable an internally pulled-up input pin's internal pull-up resistor.
+     */
+    void enable_pull_up() noexcept
+    {
+        port().port |= mask();
+    }
+
+    /**
+     * \brief Check if the pin is in the low state.
+     *
+     * \return true if the pin is in the low state.
+     * \return false if the pin is not in the low state.
+     */
+    auto is_low() const noexcept -> bool
+    {
+        return not is_high();
+    }
+
+    /**
+     * \brief Check if the pin is in the high state.
+     *
+     * \return true if the pin is in the high state.
+     * \return false if the pin is not in the high state.
+     */
+    auto is_high() const noexcept -> bool
+    {
+        return port().pin & mask();
+    }
+
+    /**
+     * \brief Transition an open-drain I/O pin to the low state.
+     */
+    void transition_open_drain_io_to_low() noexcept
+    {
+        port().ddr |= mask();
+    }
+
+    /**
+     * \brief Transition a push-pull I/O pin to the low state.
+     */
+    void transition_push_pull_io_to_low() noexcept
+    {
+        port().port &= ~mask();
+    }
+
+    /**
+     * \brief Transition an open-drain I/O pin to the high state.
+     */
+    void transition_open_drain_io_to_high() noexcept
+    {
+        port().ddr &= ~mask();
+    }
+
+    /**
+     * \brief Transition a push-pull I/O pin to the high state.
+     */
+    void transition_push_pull_io_to_high() noexcept
+    {
+        port().port |= mask();
+    }
+
+    /**
+     * \brief Toggle the state of an open-drain I/O pin.
+     */
+    void toggle_open_drain_io() noexcept
+    {
+        port().ddr ^= mask();
+    }
+
+    /**
+     * \brief Toggle the state of a push-pull I/O pin.
+     */
+    void toggle_push_pull_io() noexcept
+    {
+        port().pin = mask();
+    }
+
+  private:
+    /**
+     * \brief The GPIO port index field offset.
+     */
+    static constexpr auto PORT_OFFSET = std::uint_fast8_t{ 3 };
+
+    /**
+     * \brief The bit number field mask.
+     */
+    static constexpr auto BIT_MASK = std::uint8_t{ 0b111 };
+
+    /**
+     * \brief The GPIO port index (plus one, zero if the pin is not associated with a GPIO
+     *        port) and the pin's bit number.
+     */
+    std::uint8_t m_pin{};
+
+    /**
+     * \brief Get the GPIO port the pin is a member of.
+     *
+     * \return The GPIO port the pin is a member of.
+     */
+    auto port() const noexcept -> Peripheral::PORT &
+    {
+        return *reinterpret_cast<Peripheral::PORT *>(
+            port_address( static_cast<Port>( ( m_pin >> PORT_OFFSET ) - 1 ) ) );
+    }
+
+    /**
+     * \brief Get the mask identifying the pin.
+     *
+     * \return The mask identifying the pin.
+     */
+    constexpr auto mask() const noexcept -> std::uint8_t
+    {
+        return 1 << ( m_pin & BIT_MASK );
+    }
+};
+
 /**
  * \brief Internally pulled-up input pin.
+ *
+ * \tparam Pin_Type The type of pin used by the wrapper
+ *         (picolibrary::Microchip::megaAVR::GPIO::Pin or
+ *         picolibrary::Microchip::megaAVR::GPIO::Compact_Pin).
  */
-class Internally_Pulled_Up_Input_Pin {
+template<typename Pin_Type>
+class Generic_Internally_Pulled_Up_Input_Pin {
   public:
     /**
      * \brief Constructor.
      */
-    constexpr Internally_Pulled_Up_Input_Pin() noexcept = default;
+    constexpr Generic_Internally_Pulled_Up_Input_Pin() noexcept = default;
 
     /**
      * \brief Constructor.
      *
+     * \attention This constructor is only available if Pin_Type is
+     *            picolibrary::Microchip::megaAVR::GPIO::Pin.
+     *
      * \param[in] port The GPIO port the pin is a member of.
      * \param[in] mask The mask identifying the pin.
      */
-    constexpr Internally_Pulled_Up_Input_Pin( Peripheral::PORT & port, std::uint8_t mask ) noexcept :
+    constexpr Generic_Internally_Pulled_Up_Input_Pin( Peripheral::PORT & port, std::uint8_t mask ) noexcept :
         m_pin{ port, mask }
     {
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \attention This constructor is only available if Pin_Type is
+     *            picolibrary::Microchip::megaAVR::GPIO::Compact_Pin.
+     *
+     * \param[in] port The GPIO port the pin is a member of.
+     * \param[in] bit The pin's bit number.
+     */
+    constexpr Generic_Internally_Pulled_Up_Input_Pin( Port port, std::uint_fast8_t bit ) noexcept :
+        m_pin{ port, bit }
+    {
+    }
+
     /**
      * \brief Constructor.
      *
      * \param[in] source The source of the move.
      */
-    constexpr Internally_Pulled_Up_Input_Pin( Internally_Pulled_Up_Input_Pin && source ) noexcept = default;
+    constexpr Generic_Internally_Pulled_Up_Input_Pin( Generic_Internally_Pulled_Up_Input_Pin && source ) noexcept = default;
 
-    Internally_Pulled_Up_Input_Pin( Internally_Pulled_Up_Input_Pin const & ) = delete;
+    Generic_Internally_Pulled_Up_Input_Pin( Generic_Internally_Pulled_Up_Input_Pin const & ) = delete;
 
     /**
      * \brief Destructor.
      */
-    ~Internally_Pulled_Up_Input_Pin() noexcept
+    ~Generic_Internally_Pulled_Up_Input_Pin() noexcept
     {
         disable();
     }
@@ -304,8 +652,8 @@ class Internally_Pulled_Up_Input_Pin {
      *
      * \return The assigned to object.
      */
-    constexpr auto operator=( Internally_Pulled_Up_Input_Pin && expression ) noexcept
-        -> Internally_Pulled_Up_Input_Pin &
+    constexpr auto operator=( Generic_Internally_Pulled_Up_Input_Pin && expression ) noexcept
+        -> Generic_Internally_Pulled_Up_Input_Pin &
     {
         if ( &expression != this ) {
             disable();
@@ -316,7 +664,7 @@ class Internally_Pulled_Up_Input_Pin {
         return *this;
     }
 
-    auto operator=( Internally_Pulled_Up_Input_Pin const & ) = delete;
+    auto operator=( Generic_Internally_Pulled_Up_Input_Pin const & ) = delete;
 
     /**
      * \brief Initialize the pin's hardware.
@@ -402,7 +750,7 @@ class Internally_Pulled_Up_Input_Pin {
     /**
      * \brief The pin.
      */
-    Pin m_pin{};
+    Pin_Type m_pin{};
 
     /**
      * \brief Disable the pin.
@@ -415,40 +763,73 @@ class Internally_Pulled_Up_Input_Pin {
     }
 };
 
+/**
+ * \brief Internally pulled-up input pin.
+ */
+using Internally_Pulled_Up_Input_Pin = Generic_Internally_Pulled_Up_Input_Pin<Pin>;
+
+/**
+ * \brief Compact internally pulled-up input pin.
+ */
+using Compact_Internally_Pulled_Up_Input_Pin =
+    Generic_Internally_Pulled_Up_Input_Pin<Compact_Pin>;
+
 /**
  * \brief Open-drain I/O pin.
+ *
+ * \tparam Pin_Type The type of pin used by the wrapper
+ *         (picolibrary::Microchip::megaAVR::GPIO::Pin or
+ *         picolibrary::Microchip::megaAVR::GPIO::Compact_Pin).
  */
-class Open_Drain_IO_Pin {
+template<typename Pin_Type>
+class Generic_Open_Drain_IO_Pin {
   public:
     /**
      * \brief Constructor.
      */
-    constexpr Open_Drain_IO_Pin() noexcept = default;
+    constexpr Generic_Open_Drain_IO_Pin() noexcept = default;
 
     /**
      * \brief Constructor.
      *
+     * \attention This constructor is only available if Pin_Type is
+     *            picolibrary::Microchip::megaAVR::GPIO::Pin.
+     *
      * \param[in] port The GPIO port the pin is a member of.
      * \param[in] mask The mask identifying the pin.
      */
-    constexpr Open_Drain_IO_Pin( Peripheral::PORT & port, std::uint8_t mask ) noexcept :
+    constexpr Generic_Open_Drain_IO_Pin( Peripheral::PORT & port, std::uint8_t mask ) noexcept :
         m_pin{ port, mask }
     {
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \attention This constructor is only available if Pin_Type is
+     *            picolibrary::Microchip::megaAVR::GPIO::Compact_Pin.
+     *
+     * \param[in] port The GPIO port the pin is a member of.
+     * \param[in] bit The pin's bit number.
+     */
+    constexpr Generic_Open_Drain_IO_Pin( Port port, std::uint_fast8_t bit ) noexcept :
+        m_pin{ port, bit }
+    {
+    }
+
     /**
      * \brief Constructor.
      *
      * \param[in] source The source of the move.
      */
-    constexpr Open_Drain_IO_Pin( Open_Drain_IO_Pin && source ) noexcept = default;
+    constexpr Generic_Open_Drain_IO_Pin( Generic_Open_Drain_IO_Pin && source ) noexcept = default;
 
-    Open_Drain_IO_Pin( Open_Drain_IO_Pin const & ) = delete;
+    Generic_Open_Drain_IO_Pin( Generic_Open_Drain_IO_Pin const & ) = delete;
 
     /**
      * \brief Destructor.
      */
-    ~Open_Drain_IO_Pin() noexcept
+    ~Generic_Open_Drain_IO_Pin() noexcept
     {
         disable();
     }
@@ -460,7 +841,7 @@ class Open_Drain_IO_Pin {
      *
      * \return The assigned to object.
      */
-    constexpr auto operator=( Open_Drain_IO_Pin && expression ) noexcept -> Open_Drain_IO_Pin &
+    constexpr auto operator=( Generic_Open_Drain_IO_Pin && expression ) noexcept -> Generic_Open_Drain_IO_Pin &
     {
         if ( &expression != this ) {
             disable();
@@ -471,7 +852,7 @@ class Open_Drain_IO_Pin {
         return *this;
     }
 
-    auto operator=( Open_Drain_IO_Pin const & ) = delete;
+    auto operator=( Generic_Open_Drain_IO_Pin const & ) = delete;
 
     /**
      * \brief Initialize the pin's hardware.
@@ -542,7 +923,7 @@ class Open_Drain_IO_Pin {
     /**
      * \brief The pin.
      */
-    Pin m_pin{};
+    Pin_Type m_pin{};
 
     /**
      * \brief Disable the pin.
@@ -555,40 +936,72 @@ class Open_Drain_IO_Pin {
     }
 };
 
+/**
+ * \brief Open-drain I/O pin.
+ */
+using Open_Drain_IO_Pin = Generic_Open_Drain_IO_Pin<Pin>;
+
+/**
+ * \brief Compact open-drain I/O pin.
+ */
+using Compact_Open_Drain_IO_Pin = Generic_Open_Drain_IO_Pin<Compact_Pin>;
+
 /**
  * \brief Push-pull I/O pin.
+ *
+ * \tparam Pin_Type The type of pin used by the wrapper
+ *         (picolibrary::Microchip::megaAVR::GPIO::Pin or
+ *         picolibrary::Microchip::megaAVR::GPIO::Compact_Pin).
  */
-class Push_Pull_IO_Pin {
+template<typename Pin_Type>
+class Generic_Push_Pull_IO_Pin {
   public:
     /**
      * \brief Constructor.
      */
-    constexpr Push_Pull_IO_Pin() noexcept = default;
+    constexpr Generic_Push_Pull_IO_Pin() noexcept = default;
 
     /**
      * \brief Constructor.
      *
+     * \attention This constructor is only available if Pin_Type is
+     *            picolibrary::Microchip::megaAVR::GPIO::Pin.
+     *
      * \param[in] port The GPIO port the pin is a member of.
      * \param[in] mask The mask identifying the pin.
      */
-    constexpr Push_Pull_IO_Pin( Peripheral::PORT & port, std::uint8_t mask ) noexcept :
+    constexpr Generic_Push_Pull_IO_Pin( Peripheral::PORT & port, std::uint8_t mask ) noexcept :
         m_pin{ port, mask }
     {
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \attention This constructor is only available if Pin_Type is
+     *            picolibrary::Microchip::megaAVR::GPIO::Compact_Pin.
+     *
+     * \param[in] port The GPIO port the pin is a member of.
+     * \param[in] bit The pin's bit number.
+     */
+    constexpr Generic_Push_Pull_IO_Pin( Port port, std::uint_fast8_t bit ) noexcept :
+        m_pin{ port, bit }
+    {
+    }
+
     /**
      * \brief Constructor.
      *
      * \param[in] source The source of the move.
      */
-    constexpr Push_Pull_IO_Pin( Push_Pull_IO_Pin && source ) noexcept = default;
+    constexpr Generic_Push_Pull_IO_Pin( Generic_Push_Pull_IO_Pin && source ) noexcept = default;
 
-    Push_Pull_IO_Pin( Push_Pull_IO_Pin const & ) = delete;
+    Generic_Push_Pull_IO_Pin( Generic_Push_Pull_IO_Pin const & ) = delete;
 
     /**
      * \brief Destructor.
      */
-    ~Push_Pull_IO_Pin() noexcept
+    ~Generic_Push_Pull_IO_Pin() noexcept
     {
         disable();
     }
@@ -600,7 +1013,7 @@ class Push_Pull_IO_Pin {
      *
      * \return The assigned to object.
      */
-    constexpr auto operator=( Push_Pull_IO_Pin && expression ) noexcept -> Push_Pull_IO_Pin &
+    constexpr auto operator=( Generic_Push_Pull_IO_Pin && expression ) noexcept -> Generic_Push_Pull_IO_Pin &
     {
         if ( &expression != this ) {
             disable();
@@ -611,7 +1024,7 @@ class Push_Pull_IO_Pin {
         return *this;
     }
 
-    auto operator=( Push_Pull_IO_Pin const & ) = delete;
+    auto operator=( Generic_Push_Pull_IO_Pin const & ) = delete;
 
     /**
      * \brief Initialize the pin's hardware.
@@ -682,7 +1095,7 @@ class Push_Pull_IO_Pin {
     /**
      * \brief The pin.
      */
-    Pin m_pin{};
+    Pin_Type m_pin{};
 
     /**
      * \brief Disable the pin.
@@ -696,6 +1109,16 @@ class Push_Pull_IO_Pin {
     }
 };
 
+/**
+ * \brief Push-pull I/O pin.
+ */
+using Push_Pull_IO_Pin = Generic_Push_Pull_IO_Pin<Pin>;
+
+/**
+ * \brief Compact push-pull I/O pin.
+ */
+using Compact_Push_Pull_IO_Pin = Generic_Push_Pull_IO_Pin<Compact_Pin>;
+
 } // namespace picolibrary::Microchip::megaAVR::GPIO
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR_GPIO_H
@@ -27,7 +27,9 @@
 
 #include "picolibrary/error.h"
 #include "picolibrary/i2c.h"
+#include "picolibrary/microchip/megaavr/clock.h"
 #include "picolibrary/microchip/megaavr/peripheral/twi.h"
+#include "picolibrary/microchip/megaavr/power.h"
 #include "picolibrary/postcondition.h"
 #include "picolibrary/utility.h"
 
@@ -71,6 +73,8 @@ class Basic_Controller {
         std::uint8_t twi_bit_rate_generator_scaling_factor ) noexcept :
         m_twi{ &twi }
     {
+        Power::acquire( twi );
+
         configure_controller( twi_bit_rate_generator_prescaler_value, twi_bit_rate_generator_scaling_factor );
     }
 
@@ -80,7 +84,8 @@ class Basic_Controller {
      * \param[in] source The source of the move.
      */
     constexpr Basic_Controller( Basic_Controller && source ) noexcept :
-        m_twi{ source.m_twi }
+        m_twi{ source.m_twi },
+        m_twbr{ source.m_twbr }
     {
         source.m_twi = nullptr;
     }
@@ -107,7 +112,8 @@ class Basic_Controller {
         if ( &expression != this ) {
             disable();
 
-            m_twi = expression.m_twi;
+            m_twi  = expression.m_twi;
+            m_twbr = expression.m_twbr;
 
             expression.m_twi = nullptr;
         } // if
@@ -295,12 +301,34 @@ class Basic_Controller {
         return ::picolibrary::I2C::Response::NACK; // unreachable
     }
 
+    /**
+     * \brief Handle a system clock prescaler change.
+     *
+     * \param[in] previous_shift The previous clock shift.
+     * \param[in] shift The new clock shift.
+     */
+    void handle_clock_change( std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept
+    {
+        static_cast<void>( previous_shift );
+
+        m_twi->twbr = Clock::scale_twbr(
+            m_twbr,
+            ( m_twi->twsr & Peripheral::TWI::TWSR::Mask::TWPS ) >> Peripheral::TWI::TWSR::Bit::TWPS,
+            shift );
+    }
+
   private:
     /**
      * \brief The TWI used by the controller.
      */
     Peripheral::TWI * m_twi{};
 
+    /**
+     * \brief The TWI bit rate generator scaling factor (TWBR register value) the
+     *        controller was configured with (unscaled system clock).
+     */
+    std::uint8_t m_twbr{};
+
     /**
      * \brief Disable the controller.
      */
@@ -308,6 +336,8 @@ class Basic_Controller {
     {
         if ( m_twi ) {
             disable_controller();
+
+            Power::release( *m_twi );
         } // if
     }
 
@@ -328,6 +358,8 @@ class Basic_Controller {
         m_twi->twbr  = twi_bit_rate_generator_scaling_factor;
         m_twi->twar  = 0;
         m_twi->twamr = 0;
+
+        m_twbr = twi_bit_rate_generator_scaling_factor;
     }
 
     /**
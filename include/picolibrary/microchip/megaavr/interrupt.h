@@ -25,6 +25,7 @@
 
 #include <avr-libcpp/interrupt>
 #include <cstdint>
+#include <type_traits>
 
 /**
  * \brief Microchip megaAVR interrupt facilities.
@@ -128,6 +129,240 @@ class Controller {
     static constexpr auto SREG_ADDRESS = std::uintptr_t{ 0x005F };
 };
 
+/**
+ * \brief Main (non-ISR) context tag type.
+ */
+struct Main_Context {
+};
+
+/**
+ * \brief Main (non-ISR) context tag.
+ */
+constexpr auto MAIN_CONTEXT = Main_Context{};
+
+/**
+ * \brief ISR context tag type.
+ */
+struct ISR_Context {
+};
+
+/**
+ * \brief ISR context tag.
+ */
+constexpr auto ISR_CONTEXT = ISR_Context{};
+
+/**
+ * \brief Critical section guard.
+ *
+ * The constructor saves the current interrupts enable state and disables interrupts, and
+ * the destructor restores the saved interrupts enable state.
+ *
+ * \tparam Context The context the critical section is entered from
+ *         (picolibrary::Microchip::megaAVR::Interrupt::Main_Context or
+ *         picolibrary::Microchip::megaAVR::Interrupt::ISR_Context).
+ */
+template<typename Context = Main_Context>
+class Critical_Section {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Critical_Section() noexcept :
+        m_interrupt_enable_state{ Controller{}.save_interrupt_enable_state() }
+    {
+        Controller{}.disable_interrupt();
+    }
+
+    /**
+     * \brief Constructor.
+     */
+    Critical_Section( Main_Context ) noexcept : Critical_Section{}
+    {
+    }
+
+    Critical_Section( Critical_Section && ) = delete;
+
+    Critical_Section( Critical_Section const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Critical_Section() noexcept
+    {
+        Controller{}.restore_interrupt_enable_state( m_interrupt_enable_state );
+    }
+
+    auto operator=( Critical_Section && ) = delete;
+
+    auto operator=( Critical_Section const & ) = delete;
+
+  private:
+    /**
+     * \brief The interrupts enable state that was saved when the critical section was
+     *        entered.
+     */
+    Controller::Interrupt_Enable_State m_interrupt_enable_state;
+};
+
+/**
+ * \brief ISR context critical section guard.
+ *
+ * Interrupts are already disabled when an ISR is executing (unless the ISR re-enables
+ * them), so the guard does nothing.
+ */
+template<>
+class Critical_Section<ISR_Context> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Critical_Section() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Critical_Section( ISR_Context ) noexcept
+    {
+    }
+
+    Critical_Section( Critical_Section && ) = delete;
+
+    Critical_Section( Critical_Section const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * The destructor is user-provided (instead of defaulted) so that guards are not
+     * reported as unused variables.
+     */
+    ~Critical_Section() noexcept
+    {
+    }
+
+    auto operator=( Critical_Section && ) = delete;
+
+    auto operator=( Critical_Section const & ) = delete;
+};
+
+/**
+ * \brief Critical section guard context deduction guide.
+ */
+Critical_Section( Main_Context ) -> Critical_Section<Main_Context>;
+
+/**
+ * \brief Critical section guard context deduction guide.
+ */
+Critical_Section( ISR_Context ) -> Critical_Section<ISR_Context>;
+
+/**
+ * \brief Nesting aware critical section guard.
+ *
+ * For code that may be entered from either a main context or an ISR context (or from
+ * within another critical section). The constructor only disables interrupts if they are
+ * enabled, and the destructor only re-enables interrupts if the constructor disabled them.
+ * Only the global interrupt enable flag is affected.
+ */
+class Nesting_Critical_Section {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Nesting_Critical_Section() noexcept :
+        m_interrupts_were_enabled{ static_cast<bool>(
+            Controller{}.save_interrupt_enable_state() & SREG_I_MASK ) }
+    {
+        if ( m_interrupts_were_enabled ) {
+            Controller{}.disable_interrupt();
+        } // if
+    }
+
+    Nesting_Critical_Section( Nesting_Critical_Section && ) = delete;
+
+    Nesting_Critical_Section( Nesting_Critical_Section const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Nesting_Critical_Section() noexcept
+    {
+        if ( m_interrupts_were_enabled ) {
+            Controller{}.enable_interrupt();
+        } // if
+    }
+
+    auto operator=( Nesting_Critical_Section && ) = delete;
+
+    auto operator=( Nesting_Critical_Section const & ) = delete;
+
+  private:
+    /**
+     * \brief SREG register I (global interrupt enable) bit mask.
+     */
+    static constexpr auto SREG_I_MASK = std::uint8_t{ 1 << 7 };
+
+    /**
+     * \brief Interrupts were enabled when the critical section was entered.
+     */
+    bool m_interrupts_were_enabled;
+};
+
+/**
+ * \brief Compile time binding of an interrupt handler to a driver object.
+ *
+ * Since the driver object and its interrupt handler are template parameters, the handler
+ * is called directly (not through a function pointer), so no EIND trampoline is needed on
+ * the ATmega2560. The handler, and every function it calls, is forcibly inlined into the
+ * ISR (flatten) wherever its definition is visible, so the ISR only saves the registers
+ * the inlined code uses. If the handler calls a function whose definition is not visible
+ * (e.g. a function defined in another translation unit), the ISR saves every call
+ * clobbered register. Use PICOLIBRARY_MICROCHIP_MEGAAVR_INTERRUPT_BIND() to define an ISR
+ * that calls a bound interrupt handler.
+ *
+ * \tparam OBJECT The driver object (must have static storage duration).
+ * \tparam HANDLER The driver object's interrupt handler (member function pointer).
+ */
+template<auto & OBJECT, auto HANDLER>
+class Binding {
+  public:
+    Binding() = delete;
+
+    Binding( Binding && ) = delete;
+
+    Binding( Binding const & ) = delete;
+
+    ~Binding() = delete;
+
+    auto operator=( Binding && ) = delete;
+
+    auto operator=( Binding const & ) = delete;
+
+    /**
+     * \brief Call the driver object's interrupt handler (inlining the handler and every
+     *        function it calls).
+     */
+    __attribute__( ( always_inline, flatten ) ) static void handle() noexcept
+    {
+        ( OBJECT.*HANDLER )();
+    }
+};
+
+/**
+ * \brief Define an ISR that calls a driver object's interrupt handler.
+ *
+ * \relatedalso picolibrary::Microchip::megaAVR::Interrupt::Binding
+ *
+ * \param[in] vector The interrupt vector (e.g. `USART0_UDRE_vect`).
+ * \param[in] object The driver object (must have static storage duration).
+ * \param[in] handler The name of the driver object's interrupt handler member function.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_INTERRUPT_BIND( vector, object, handler )          \
+    ISR( vector, __attribute__( ( flatten ) ) )                                          \
+    {                                                                                    \
+        ::picolibrary::Microchip::megaAVR::Interrupt::Binding<                          \
+            object,                                                                      \
+            &::std::remove_reference_t<decltype( object )>::handler>::handle();          \
+    }
+
 } // namespace picolibrary::Microchip::megaAVR::Interrupt
 
 #endif // PICOLIBRARY_MICROCHIP_MEGAAVR_INTERRUPT_H
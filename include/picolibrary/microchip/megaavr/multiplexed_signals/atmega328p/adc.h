@@ -0,0 +1,185 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Multiplexed_Signals::ATmega328P ADC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_MULTIPLEXED_SIGNALS_ATMEGA328P_ADC_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_MULTIPLEXED_SIGNALS_ATMEGA328P_ADC_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/peripheral/adc.h"
+#include "picolibrary/microchip/megaavr/peripheral/atmega328p.h"
+#include "picolibrary/microchip/megaavr/peripheral/port.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::megaAVR::Multiplexed_Signals::ATmega328P {
+
+/**
+ * \brief Lookup an ADC peripheral's ADCn (input) pin PORT peripheral address.
+ *
+ * \attention This function should not be called directly. Instead, set the `-mmcu`
+ *            compiler flag to `atmega328p` and call
+ *            picolibrary::Microchip::megaAVR::Multiplexed_Signals::adc_input_port_address().
+ *
+ * \attention The ATmega328/P's ADC6 and ADC7 inputs are not multiplexed with PORT
+ *            peripheral pins.
+ *
+ * \param[in] adc_address The address of the ADC peripheral whose ADCn pin PORT
+ *            peripheral address is to be looked up.
+ * \param[in] input The ADC input (n) whose pin PORT peripheral address is to be looked
+ *            up.
+ *
+ * \return The ADC peripheral's ADCn pin PORT peripheral address.
+ */
+constexpr auto adc_input_port_address( std::uintptr_t adc_address, std::uint_fast8_t input ) noexcept
+    -> std::uintptr_t
+{
+    switch ( adc_address ) {
+        case Peripheral::ATmega328P::ADC0::ADDRESS:
+            if ( input <= 5 ) {
+                return Peripheral::ATmega328P::PORTC::ADDRESS;
+            } // if
+            break;
+    } // switch
+
+    PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Lookup an ADC peripheral's ADCn (input) pin PORT peripheral.
+ *
+ * \attention This function should not be called directly. Instead, set the `-mmcu`
+ *            compiler flag to `atmega328p` and call
+ *            picolibrary::Microchip::megaAVR::Multiplexed_Signals::adc_input_port().
+ *
+ * \attention The ATmega328/P's ADC6 and ADC7 inputs are not multiplexed with PORT
+ *            peripheral pins.
+ *
+ * \param[in] adc The ADC peripheral whose ADCn pin PORT peripheral is to be looked up.
+ * \param[in] input The ADC input (n) whose pin PORT peripheral is to be looked up.
+ *
+ * \return The ADC peripheral's ADCn pin PORT peripheral.
+ */
+inline auto adc_input_port( Peripheral::ADC const & adc, std::uint_fast8_t input ) noexcept
+    -> Peripheral::PORT &
+{
+    return *reinterpret_cast<Peripheral::PORT *>(
+        adc_input_port_address( reinterpret_cast<std::uintptr_t>( &adc ), input ) );
+}
+
+/**
+ * \brief Lookup an ADC peripheral's ADCn (input) pin number.
+ *
+ * \attention This function should not be called directly. Instead, set the `-mmcu`
+ *            compiler flag to `atmega328p` and call
+ *            picolibrary::Microchip::megaAVR::Multiplexed_Signals::adc_input_number().
+ *
+ * \attention The ATmega328/P's ADC6 and ADC7 inputs are not multiplexed with PORT
+ *            peripheral pins.
+ *
+ * \param[in] adc_address The address of the ADC peripheral whose ADCn pin number is to
+ *            be looked up.
+ * \param[in] input The ADC input (n) whose pin number is to be looked up.
+ *
+ * \return The ADC peripheral's ADCn pin number.
+ */
+constexpr auto adc_input_number( std::uintptr_t adc_address, std::uint_fast8_t input ) noexcept
+    -> std::uint_fast8_t
+{
+    switch ( adc_address ) {
+        case Peripheral::ATmega328P::ADC0::ADDRESS:
+            if ( input <= 5 ) {
+                return input;
+            } // if
+            break;
+    } // switch
+
+    PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Lookup an ADC peripheral's ADCn (input) pin number.
+ *
+ * \attention This function should not be called directly. Instead, set the `-mmcu`
+ *            compiler flag to `atmega328p` and call
+ *            picolibrary::Microchip::megaAVR::Multiplexed_Signals::adc_input_number().
+ *
+ * \attention The ATmega328/P's ADC6 and ADC7 inputs are not multiplexed with PORT
+ *            peripheral pins.
+ *
+ * \param[in] adc The ADC peripheral whose ADCn pin number is to be looked up.
+ * \param[in] input The ADC input (n) whose pin number is to be looked up.
+ *
+ * \return The ADC peripheral's ADCn pin number.
+ */
+inline auto adc_input_number( Peripheral::ADC const & adc, std::uint_fast8_t input ) noexcept
+    -> std::uint_fast8_t
+{
+    return adc_input_number( reinterpret_cast<std::uintptr_t>( &adc ), input );
+}
+
+/**
+ * \brief Lookup an ADC peripheral's ADCn (input) pin mask.
+ *
+ * \attention This function should not be called directly. Instead, set the `-mmcu`
+ *            compiler flag to `atmega328p` and call
+ *            picolibrary::Microchip::megaAVR::Multiplexed_Signals::adc_input_mask().
+ *
+ * \attention The ATmega328/P's ADC6 and ADC7 inputs are not multiplexed with PORT
+ *            peripheral pins.
+ *
+ * \param[in] adc_address The address of the ADC peripheral whose ADCn pin mask is to be
+ *            looked up.
+ * \param[in] input The ADC input (n) whose pin mask is to be looked up.
+ *
+ * \return The ADC peripheral's ADCn pin mask.
+ */
+constexpr auto adc_input_mask( std::uintptr_t adc_address, std::uint_fast8_t input ) noexcept
+    -> std::uint8_t
+{
+    return 1 << adc_input_number( adc_address, input );
+}
+
+/**
+ * \brief Lookup an ADC peripheral's ADCn (input) pin mask.
+ *
+ * \attention This function should not be called directly. Instead, set the `-mmcu`
+ *            compiler flag to `atmega328p` and call
+ *            picolibrary::Microchip::megaAVR::Multiplexed_Signals::adc_input_mask().
+ *
+ * \attention The ATmega328/P's ADC6 and ADC7 inputs are not multiplexed with PORT
+ *            peripheral pins.
+ *
+ * \param[in] adc The ADC peripheral whose ADCn pin mask is to be looked up.
+ * \param[in] input The ADC input (n) whose pin mask is to be looked up.
+ *
+ * \return The ADC peripheral's ADCn pin mask.
+ */
+inline auto adc_input_mask( Peripheral::ADC const & adc, std::uint_fast8_t input ) noexcept
+    -> std::uint8_t
+{
+    return adc_input_mask( reinterpret_cast<std::uintptr_t>( &adc ), input );
+}
+
+} // namespace picolibrary::Microchip::megaAVR::Multiplexed_Signals::ATmega328P
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_MULTIPLEXED_SIGNALS_ATMEGA328P_ADC_H
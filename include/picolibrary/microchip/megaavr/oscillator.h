@@ -0,0 +1,348 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Oscillator interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_OSCILLATOR_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_OSCILLATOR_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/eeprom.h"
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/sysctrl.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc16.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc8_async.h"
+#include "picolibrary/microchip/megaavr/power.h"
+
+/**
+ * \brief Microchip megaAVR calibrated RC oscillator facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Oscillator {
+
+/**
+ * \brief The frequency of the reference clock (a 32.768 kHz watch crystal).
+ */
+constexpr auto REFERENCE_FREQUENCY = std::uint32_t{ 32'768 };
+
+/**
+ * \brief The number of reference clock cycles a measurement spans.
+ */
+constexpr auto MEASUREMENT_REFERENCE_CYCLES = std::uint_fast8_t{ 64 };
+
+/**
+ * \brief The OSCCAL frequency range selection bit.
+ */
+constexpr auto OSCCAL_RANGE = std::uint8_t{ 0b1'0000000 };
+
+/**
+ * \brief Compute the number of system clock cycles a measurement spans if the system
+ *        clock is running at a specific frequency.
+ *
+ * \param[in] frequency The system clock frequency.
+ *
+ * \return The number of system clock cycles a measurement spans if the system clock is
+ *         running at the specified frequency.
+ */
+constexpr auto measurement_cycles( std::uint32_t frequency ) noexcept -> std::uint16_t
+{
+    return static_cast<std::uint16_t>(
+        ( frequency * MEASUREMENT_REFERENCE_CYCLES + REFERENCE_FREQUENCY / 2 ) / REFERENCE_FREQUENCY );
+}
+
+/**
+ * \brief Set the RC oscillator calibration value.
+ *
+ * The calibration value is stepped one LSB at a time so that the RC oscillator frequency
+ * never changes by more than 2% from one cycle to the next.
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ * \param[in] calibration The RC oscillator calibration value.
+ */
+inline void set_calibration( Peripheral::SYSCTRL & sysctrl, std::uint8_t calibration ) noexcept
+{
+    for ( std::uint8_t value = sysctrl.osccal; value != calibration; ) {
+        value = value < calibration ? value + 1 : value - 1;
+
+        sysctrl.osccal = value;
+    } // for
+}
+
+/**
+ * \brief Store an RC oscillator calibration value in EEPROM.
+ *
+ * The calibration value is stored alongside its complement (2 bytes) so that an erased
+ * or corrupted record can be detected.
+ *
+ * \tparam Controller The type of EEPROM controller used to access the EEPROM.
+ *
+ * \param[in] eeprom The EEPROM controller used to access the EEPROM.
+ * \param[in] address The address of the record.
+ * \param[in] calibration The RC oscillator calibration value.
+ */
+template<typename Controller>
+void store( Controller & eeprom, EEPROM::Address address, std::uint8_t calibration ) noexcept
+{
+    std::uint8_t const record[] = { calibration, static_cast<std::uint8_t>( ~calibration ) };
+
+    eeprom.write( address, &record[ 0 ], &record[ 0 ] + sizeof( record ) );
+}
+
+/**
+ * \brief Restore an RC oscillator calibration value that was stored in EEPROM.
+ *
+ * \tparam Controller The type of EEPROM controller used to access the EEPROM.
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ * \param[in] eeprom The EEPROM controller used to access the EEPROM.
+ * \param[in] address The address of the record.
+ *
+ * \return true if a valid calibration value was found and applied.
+ * \return false if the record is erased or corrupted (the factory calibration value is
+ *         left in place).
+ */
+template<typename Controller>
+auto restore( Peripheral::SYSCTRL & sysctrl, Controller const & eeprom, EEPROM::Address address ) noexcept
+    -> bool
+{
+    std::uint8_t record[ 2 ];
+
+    eeprom.read( address, &record[ 0 ], &record[ 0 ] + sizeof( record ) );
+
+    if ( record[ 1 ] != static_cast<std::uint8_t>( ~record[ 0 ] ) ) {
+        return false;
+    } // if
+
+    set_calibration( sysctrl, record[ 0 ] );
+
+    return true;
+}
+
+/**
+ * \brief RC oscillator calibrator.
+ *
+ * The calibrator measures the system clock against a 32.768 kHz watch crystal connected
+ * to the TOSC1/TOSC2 pins of a TC8_ASYNC peripheral (TC2), counting system clock cycles
+ * with a TC16 peripheral while the TC8_ASYNC peripheral counts
+ * picolibrary::Microchip::megaAVR::Oscillator::MEASUREMENT_REFERENCE_CYCLES crystal
+ * cycles, and binary searches the OSCCAL value whose measurement is closest to the
+ * requested frequency.
+ *
+ * \attention The crystal oscillator may need up to 1 s to stabilize after
+ *            picolibrary::Microchip::megaAVR::Oscillator::Calibrator::initialize() is
+ *            called. Measurements taken before the crystal oscillator has stabilized are
+ *            not reliable.
+ *
+ * \attention The TC8_ASYNC and TC16 peripherals must not be used for anything else while
+ *            the calibrator exists.
+ */
+class Calibrator {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Calibrator() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] sysctrl The SYSCTRL peripheral.
+     * \param[in] reference_timer The TC8_ASYNC peripheral the reference crystal is
+     *            connected to.
+     * \param[in] measurement_timer The TC16 peripheral used to count system clock cycles.
+     */
+    Calibrator(
+        Peripheral::SYSCTRL &   sysctrl,
+        Peripheral::TC8_ASYNC & reference_timer,
+        Peripheral::TC16 &      measurement_timer ) noexcept :
+        m_sysctrl{ &sysctrl },
+        m_reference_timer{ &reference_timer },
+        m_measurement_timer{ &measurement_timer }
+    {
+        Power::acquire( reference_timer );
+        Power::acquire( measurement_timer );
+    }
+
+    Calibrator( Calibrator && ) = delete;
+
+    Calibrator( Calibrator const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Calibrator() noexcept
+    {
+        disable();
+    }
+
+    auto operator=( Calibrator && ) = delete;
+
+    auto operator=( Calibrator const & ) = delete;
+
+    /**
+     * \brief Initialize the calibrator's hardware.
+     *
+     * The TC8_ASYNC peripheral is switched to asynchronous operation (clocked from the
+     * crystal) and started in normal mode, and the TC16 peripheral is stopped and
+     * configured for normal mode.
+     */
+    void initialize() noexcept
+    {
+        m_measurement_timer->tccrb = 0;
+        m_measurement_timer->tccra = 0;
+
+        m_reference_timer->assr  = Peripheral::TC8_ASYNC::ASSR::Mask::AS;
+        m_reference_timer->tcnt  = 0;
+        m_reference_timer->tccra = 0;
+        m_reference_timer->tccrb = Peripheral::TC8_ASYNC::TCCRB::CS_CLK_TS_1;
+
+        while ( m_reference_timer->assr
+                & ( Peripheral::TC8_ASYNC::ASSR::Mask::TCNUB | Peripheral::TC8_ASYNC::ASSR::Mask::TCRAUB
+                    | Peripheral::TC8_ASYNC::ASSR::Mask::TCRBUB ) ) {} // while
+    }
+
+    /**
+     * \brief Measure the system clock.
+     *
+     * \return The number of system clock cycles that elapsed while the reference clock
+     *         completed picolibrary::Microchip::megaAVR::Oscillator::MEASUREMENT_REFERENCE_CYCLES
+     *         cycles.
+     */
+    auto measure() noexcept -> std::uint16_t
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        m_measurement_timer->tcnt = 0;
+
+        std::uint8_t const previous_tcnt = m_reference_timer->tcnt;
+        while ( m_reference_timer->tcnt == previous_tcnt ) {} // while
+
+        m_measurement_timer->tccrb = Peripheral::TC16::TCCRB::CS_CLK_IO_1;
+
+        auto const tcnt = static_cast<std::uint8_t>( previous_tcnt + 1 );
+        while ( static_cast<std::uint8_t>( m_reference_timer->tcnt - tcnt ) < MEASUREMENT_REFERENCE_CYCLES ) {} // while
+
+        m_measurement_timer->tccrb = Peripheral::TC16::TCCRB::CS_NONE;
+
+        return m_measurement_timer->tcnt;
+    }
+
+    /**
+     * \brief Calibrate the RC oscillator.
+     *
+     * The OSCCAL frequency range selected by the current calibration value (the factory
+     * calibration value at reset) is searched.
+     *
+     * \param[in] frequency The desired system clock frequency (the RC oscillator
+     *            frequency divided by the current system clock prescaler).
+     *
+     * \pre frequency <= 20 MHz
+     *
+     * \return The RC oscillator calibration value that was selected and applied.
+     */
+    auto calibrate( std::uint32_t frequency = F_CPU ) noexcept -> std::uint8_t
+    {
+        auto const         cycles = measurement_cycles( frequency );
+        std::uint8_t const range  = m_sysctrl->osccal & OSCCAL_RANGE;
+
+        auto low  = std::uint8_t{ 0 };
+        auto high = static_cast<std::uint8_t>( ~OSCCAL_RANGE );
+        while ( low < high ) {
+            auto const middle = static_cast<std::uint8_t>( ( low + high ) / 2 );
+
+            set_calibration( *m_sysctrl, range | middle );
+
+            if ( measure() < cycles ) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            } // else
+        }     // while
+
+        auto calibration = static_cast<std::uint8_t>( range | low );
+
+        if ( low > 0 ) {
+            set_calibration( *m_sysctrl, calibration );
+            auto const error = distance( measure(), cycles );
+
+            set_calibration( *m_sysctrl, calibration - 1 );
+            if ( distance( measure(), cycles ) < error ) {
+                return calibration - 1;
+            } // if
+        }     // if
+
+        set_calibration( *m_sysctrl, calibration );
+
+        return calibration;
+    }
+
+  private:
+    /**
+     * \brief The SYSCTRL peripheral.
+     */
+    Peripheral::SYSCTRL * m_sysctrl{};
+
+    /**
+     * \brief The TC8_ASYNC peripheral the reference crystal is connected to.
+     */
+    Peripheral::TC8_ASYNC * m_reference_timer{};
+
+    /**
+     * \brief The TC16 peripheral used to count system clock cycles.
+     */
+    Peripheral::TC16 * m_measurement_timer{};
+
+    /**
+     * \brief Compute the distance between two measurements.
+     *
+     * \param[in] a A measurement.
+     * \param[in] b A measurement.
+     *
+     * \return The distance between the measurements.
+     */
+    static constexpr auto distance( std::uint16_t a, std::uint16_t b ) noexcept -> std::uint16_t
+    {
+        return a < b ? b - a : a - b;
+    }
+
+    /**
+     * \brief Disable the calibrator's hardware.
+     *
+     * The timers are stopped and the calibrator's references to their modules are
+     * released. A module that is still referenced by another driver (e.g. a software
+     * timer service or RTC service constructed before the calibrator) stays powered up.
+     */
+    void disable() noexcept
+    {
+        if ( m_sysctrl ) {
+            m_measurement_timer->tccrb = 0;
+
+            m_reference_timer->tccrb = 0;
+            m_reference_timer->assr  = 0;
+
+            Power::release( *m_measurement_timer );
+            Power::release( *m_reference_timer );
+        } // if
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Oscillator
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_OSCILLATOR_H
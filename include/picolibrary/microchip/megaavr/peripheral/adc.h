@@ -0,0 +1,365 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Peripheral::ADC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_ADC_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_ADC_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::megaAVR::Peripheral {
+
+/**
+ * \brief Microchip megaAVR Analog-to-Digital Converter (ADC) peripheral.
+ */
+class ADC {
+  public:
+    /**
+     * \brief ADC Control and Status Register A (ADCSRA) register.
+     *
+     * This register has the following fields:
+     * - ADC Prescaler Select Bits (ADPS)
+     * - ADC Interrupt Enable (ADIE)
+     * - ADC Interrupt Flag (ADIF)
+     * - ADC Auto Trigger Enable (ADATE)
+     * - ADC Start Conversion (ADSC)
+     * - ADC Enable (ADEN)
+     */
+    class ADCSRA : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto ADPS  = std::uint_fast8_t{ 3 }; ///< ADPS.
+            static constexpr auto ADIE  = std::uint_fast8_t{ 1 }; ///< ADIE.
+            static constexpr auto ADIF  = std::uint_fast8_t{ 1 }; ///< ADIF.
+            static constexpr auto ADATE = std::uint_fast8_t{ 1 }; ///< ADATE.
+            static constexpr auto ADSC  = std::uint_fast8_t{ 1 }; ///< ADSC.
+            static constexpr auto ADEN  = std::uint_fast8_t{ 1 }; ///< ADEN.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto ADPS = std::uint_fast8_t{}; ///< ADPS.
+            static constexpr auto ADIE = std::uint_fast8_t{ ADPS + Size::ADPS }; ///< ADIE.
+            static constexpr auto ADIF = std::uint_fast8_t{ ADIE + Size::ADIE }; ///< ADIF.
+            static constexpr auto ADATE = std::uint_fast8_t{ ADIF + Size::ADIF }; ///< ADATE.
+            static constexpr auto ADSC = std::uint_fast8_t{ ADATE + Size::ADATE }; ///< ADSC.
+            static constexpr auto ADEN = std::uint_fast8_t{ ADSC + Size::ADSC }; ///< ADEN.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto ADPS = mask<std::uint8_t>( Size::ADPS, Bit::ADPS ); ///< ADPS.
+            static constexpr auto ADIE = mask<std::uint8_t>( Size::ADIE, Bit::ADIE ); ///< ADIE.
+            static constexpr auto ADIF = mask<std::uint8_t>( Size::ADIF, Bit::ADIF ); ///< ADIF.
+            static constexpr auto ADATE = mask<std::uint8_t>( Size::ADATE, Bit::ADATE ); ///< ADATE.
+            static constexpr auto ADSC = mask<std::uint8_t>( Size::ADSC, Bit::ADSC ); ///< ADSC.
+            static constexpr auto ADEN = mask<std::uint8_t>( Size::ADEN, Bit::ADEN ); ///< ADEN.
+        };
+
+        /**
+         * \brief ADPS.
+         */
+        enum ADPS : std::uint8_t {
+            ADPS_2 = 0b001 << Bit::ADPS, ///< 2.
+            ADPS_4 = 0b010 << Bit::ADPS, ///< 4.
+            ADPS_8 = 0b011 << Bit::ADPS, ///< 8.
+            ADPS_16 = 0b100 << Bit::ADPS, ///< 16.
+            ADPS_32 = 0b101 << Bit::ADPS, ///< 32.
+            ADPS_64 = 0b110 << Bit::ADPS, ///< 64.
+            ADPS_128 = 0b111 << Bit::ADPS, ///< 128.
+        };
+
+        ADCSRA() = delete;
+
+        ADCSRA( ADCSRA && ) = delete;
+
+        ADCSRA( ADCSRA const & ) = delete;
+
+        ~ADCSRA() = delete;
+
+        auto operator=( ADCSRA && ) = delete;
+
+        auto operator=( ADCSRA const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief ADC Control and Status Register B (ADCSRB) register.
+     *
+     * This register has the following fields:
+     * - ADC Auto Trigger Source (ADTS)
+     * - Analog Channel and Gain Selection Bit 5 (MUX5) (ATmega2560 only)
+     * - Analog Comparator Multiplexer Enable (ACME)
+     */
+    class ADCSRB : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto ADTS      = std::uint_fast8_t{ 3 }; ///< ADTS.
+            static constexpr auto MUX5      = std::uint_fast8_t{ 1 }; ///< MUX5.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 2 }; ///< RESERVED4.
+            static constexpr auto ACME      = std::uint_fast8_t{ 1 }; ///< ACME.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto ADTS = std::uint_fast8_t{}; ///< ADTS.
+            static constexpr auto MUX5 = std::uint_fast8_t{ ADTS + Size::ADTS }; ///< MUX5.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ MUX5 + Size::MUX5 }; ///< RESERVED4.
+            static constexpr auto ACME = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< ACME.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ ACME + Size::ACME }; ///< RESERVED7.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto ADTS = mask<std::uint8_t>( Size::ADTS, Bit::ADTS ); ///< ADTS.
+            static constexpr auto MUX5 = mask<std::uint8_t>( Size::MUX5, Bit::MUX5 ); ///< MUX5.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto ACME = mask<std::uint8_t>( Size::ACME, Bit::ACME ); ///< ACME.
+            static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+        };
+
+        /**
+         * \brief ADTS.
+         */
+        enum ADTS : std::uint8_t {
+            ADTS_FREE_RUNNING = 0b000 << Bit::ADTS, ///< Free running mode.
+            ADTS_ANALOG_COMPARATOR = 0b001 << Bit::ADTS, ///< Analog comparator.
+            ADTS_EXTERNAL_INTERRUPT_REQUEST_0 = 0b010 << Bit::ADTS, ///< External interrupt request 0.
+            ADTS_TC0_COMPARE_MATCH_A = 0b011 << Bit::ADTS, ///< TC0 compare match A.
+            ADTS_TC0_OVERFLOW = 0b100 << Bit::ADTS, ///< TC0 overflow.
+            ADTS_TC1_COMPARE_MATCH_B = 0b101 << Bit::ADTS, ///< TC1 compare match B.
+            ADTS_TC1_OVERFLOW = 0b110 << Bit::ADTS, ///< TC1 overflow.
+            ADTS_TC1_CAPTURE_EVENT = 0b111 << Bit::ADTS, ///< TC1 capture event.
+        };
+
+        ADCSRB() = delete;
+
+        ADCSRB( ADCSRB && ) = delete;
+
+        ADCSRB( ADCSRB const & ) = delete;
+
+        ~ADCSRB() = delete;
+
+        auto operator=( ADCSRB && ) = delete;
+
+        auto operator=( ADCSRB const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief ADC Multiplexer Selection Register (ADMUX) register.
+     *
+     * This register has the following fields:
+     * - Analog Channel Selection Bits (MUX) (MUX4 is reserved on the ATmega328/P)
+     * - ADC Left Adjust Result (ADLAR)
+     * - Reference Selection Bits (REFS)
+     */
+    class ADMUX : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto MUX   = std::uint_fast8_t{ 5 }; ///< MUX.
+            static constexpr auto ADLAR = std::uint_fast8_t{ 1 }; ///< ADLAR.
+            static constexpr auto REFS  = std::uint_fast8_t{ 2 }; ///< REFS.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto MUX = std::uint_fast8_t{}; ///< MUX.
+            static constexpr auto ADLAR = std::uint_fast8_t{ MUX + Size::MUX }; ///< ADLAR.
+            static constexpr auto REFS = std::uint_fast8_t{ ADLAR + Size::ADLAR }; ///< REFS.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto MUX = mask<std::uint8_t>( Size::MUX, Bit::MUX ); ///< MUX.
+            static constexpr auto ADLAR = mask<std::uint8_t>( Size::ADLAR, Bit::ADLAR ); ///< ADLAR.
+            static constexpr auto REFS = mask<std::uint8_t>( Size::REFS, Bit::REFS ); ///< REFS.
+        };
+
+        /**
+         * \brief REFS.
+         */
+        enum REFS : std::uint8_t {
+            REFS_AREF = 0b00 << Bit::REFS, ///< AREF.
+            REFS_AVCC = 0b01 << Bit::REFS, ///< AVCC.
+            REFS_INTERNAL_10 = 0b10 << Bit::REFS, ///< Internal 1.1 V (ATmega2560), reserved (ATmega328/P).
+            REFS_INTERNAL_11 = 0b11 << Bit::REFS, ///< Internal 1.1 V (ATmega328/P), internal 2.56 V (ATmega2560).
+        };
+
+        ADMUX() = delete;
+
+        ADMUX( ADMUX && ) = delete;
+
+        ADMUX( ADMUX const & ) = delete;
+
+        ~ADMUX() = delete;
+
+        auto operator=( ADMUX && ) = delete;
+
+        auto operator=( ADMUX const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Digital Input Disable Register 1 (DIDR1) register.
+     *
+     * This register has the following fields:
+     * - AIN0 Digital Input Disable (AIN0D)
+     * - AIN1 Digital Input Disable (AIN1D)
+     */
+    class DIDR1 : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto AIN0D     = std::uint_fast8_t{ 1 }; ///< AIN0D.
+            static constexpr auto AIN1D     = std::uint_fast8_t{ 1 }; ///< AIN1D.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto AIN0D = std::uint_fast8_t{}; ///< AIN0D.
+            static constexpr auto AIN1D = std::uint_fast8_t{ AIN0D + Size::AIN0D }; ///< AIN1D.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ AIN1D + Size::AIN1D }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto AIN0D = mask<std::uint8_t>( Size::AIN0D, Bit::AIN0D ); ///< AIN0D.
+            static constexpr auto AIN1D = mask<std::uint8_t>( Size::AIN1D, Bit::AIN1D ); ///< AIN1D.
+            static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+        };
+
+        DIDR1() = delete;
+
+        DIDR1( DIDR1 && ) = delete;
+
+        DIDR1( DIDR1 const & ) = delete;
+
+        ~DIDR1() = delete;
+
+        auto operator=( DIDR1 && ) = delete;
+
+        auto operator=( DIDR1 const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    union {
+        /**
+         * \brief ADC Data Register (ADC).
+         */
+        Register<std::uint16_t> adc;
+
+        struct {
+            /**
+             * \brief ADC Data Register Low Byte (ADCL).
+             */
+            Register<std::uint8_t> adcl;
+
+            /**
+             * \brief ADC Data Register High Byte (ADCH).
+             */
+            Register<std::uint8_t> adch;
+        };
+    };
+
+    /**
+     * \brief ADCSRA.
+     */
+    ADCSRA adcsra;
+
+    /**
+     * \brief ADCSRB.
+     */
+    ADCSRB adcsrb;
+
+    /**
+     * \brief ADMUX.
+     */
+    ADMUX admux;
+
+    /**
+     * \brief Digital Input Disable Register 2 (DIDR2) (ATmega2560 only, reserved on the
+     *        ATmega328/P).
+     */
+    Register<std::uint8_t> didr2;
+
+    /**
+     * \brief Digital Input Disable Register 0 (DIDR0).
+     */
+    Register<std::uint8_t> didr0;
+
+    /**
+     * \brief DIDR1.
+     */
+    DIDR1 didr1;
+
+    ADC() = delete;
+
+    ADC( ADC && ) = delete;
+
+    ADC( ADC const & ) = delete;
+
+    ~ADC() = delete;
+
+    auto operator=( ADC && ) = delete;
+
+    auto operator=( ADC const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_ADC_H
@@ -23,8 +23,15 @@
 #ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_ATMEGA328P_H
 #define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_ATMEGA328P_H
 
+#include "picolibrary/microchip/megaavr/peripheral/adc.h"
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+#include "picolibrary/microchip/megaavr/peripheral/eeprom.h"
 #include "picolibrary/microchip/megaavr/peripheral/port.h"
 #include "picolibrary/microchip/megaavr/peripheral/spi.h"
+#include "picolibrary/microchip/megaavr/peripheral/sysctrl.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc16.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc8.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc8_async.h"
 #include "picolibrary/microchip/megaavr/peripheral/twi.h"
 #include "picolibrary/microchip/megaavr/peripheral/usart.h"
 #include "picolibrary/peripheral.h"
@@ -65,6 +72,51 @@ using PORTC = ::picolibrary::Peripheral::Instance<PORT, 0x0026>;
  */
 using PORTD = ::picolibrary::Peripheral::Instance<PORT, 0x0029>;
 
+/**
+ * \brief TIFR0.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TIFR0.
+ */
+using TIFR0 = ::picolibrary::Peripheral::Instance<TC8::TIFR, 0x0035>;
+
+/**
+ * \brief TIFR1.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TIFR1.
+ */
+using TIFR1 = ::picolibrary::Peripheral::Instance<TC16::TIFR, 0x0036>;
+
+/**
+ * \brief TIFR2.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TIFR2.
+ */
+using TIFR2 = ::picolibrary::Peripheral::Instance<TC8::TIFR, 0x0037>;
+
+/**
+ * \brief EEPROM0.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::EEPROM0.
+ */
+using EEPROM0 = ::picolibrary::Peripheral::Instance<EEPROM, 0x003F>;
+
+/**
+ * \brief TC0.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC0.
+ */
+using TC0 = ::picolibrary::Peripheral::Instance<TC8, 0x0044>;
+
 /**
  * \brief SPI0.
  *
@@ -74,6 +126,78 @@ using PORTD = ::picolibrary::Peripheral::Instance<PORT, 0x0029>;
  */
 using SPI0 = ::picolibrary::Peripheral::Instance<SPI, 0x004C>;
 
+/**
+ * \brief CPU0.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::CPU0.
+ */
+using CPU0 = ::picolibrary::Peripheral::Instance<CPU, 0x0053>;
+
+/**
+ * \brief SYSCTRL0.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::SYSCTRL0.
+ */
+using SYSCTRL0 = ::picolibrary::Peripheral::Instance<SYSCTRL, 0x0060>;
+
+/**
+ * \brief TIMSK0.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TIMSK0.
+ */
+using TIMSK0 = ::picolibrary::Peripheral::Instance<TC8::TIMSK, 0x006E>;
+
+/**
+ * \brief TIMSK1.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TIMSK1.
+ */
+using TIMSK1 = ::picolibrary::Peripheral::Instance<TC16::TIMSK, 0x006F>;
+
+/**
+ * \brief TIMSK2.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TIMSK2.
+ */
+using TIMSK2 = ::picolibrary::Peripheral::Instance<TC8::TIMSK, 0x0070>;
+
+/**
+ * \brief ADC0.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::ADC0.
+ */
+using ADC0 = ::picolibrary::Peripheral::Instance<ADC, 0x0078>;
+
+/**
+ * \brief TC1.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC1.
+ */
+using TC1 = ::picolibrary::Peripheral::Instance<TC16, 0x0080>;
+
+/**
+ * \brief TC2.
+ *
+ * \attention This type should not be used directly. Instead, set the `-mmcu` compiler
+ *            flag to `atmega328p` and use
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC2.
+ */
+using TC2 = ::picolibrary::Peripheral::Instance<TC8_ASYNC, 0x00B0>;
+
 /**
  * \brief TWI0.
  *
@@ -0,0 +1,443 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Peripheral::CPU interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_CPU_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_CPU_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::megaAVR::Peripheral {
+
+/**
+ * \brief Microchip megaAVR CPU (core, sleep, reset, and self-programming control)
+ *        peripheral.
+ */
+class CPU {
+  public:
+    /**
+     * \brief Sleep Mode Control Register (SMCR) register.
+     *
+     * This register has the following fields:
+     * - Sleep Enable (SE)
+     * - Sleep Mode Select Bits (SM)
+     */
+    class SMCR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SE        = std::uint_fast8_t{ 1 }; ///< SE.
+            static constexpr auto SM        = std::uint_fast8_t{ 3 }; ///< SM.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SE = std::uint_fast8_t{}; ///< SE.
+            static constexpr auto SM = std::uint_fast8_t{ SE + Size::SE }; ///< SM.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ SM + Size::SM }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SE = mask<std::uint8_t>( Size::SE, Bit::SE ); ///< SE.
+            static constexpr auto SM = mask<std::uint8_t>( Size::SM, Bit::SM ); ///< SM.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+        };
+
+        /**
+         * \brief Sleep mode.
+         */
+        enum SM : std::uint8_t {
+            SM_IDLE = 0b000 << Bit::SM, ///< Idle.
+            SM_ADC_NOISE_REDUCTION = 0b001 << Bit::SM, ///< ADC noise reduction.
+            SM_POWER_DOWN = 0b010 << Bit::SM, ///< Power-down.
+            SM_POWER_SAVE = 0b011 << Bit::SM, ///< Power-save.
+            SM_STANDBY = 0b110 << Bit::SM, ///< Standby.
+            SM_EXTENDED_STANDBY = 0b111 << Bit::SM, ///< Extended standby.
+        };
+
+        SMCR() = delete;
+
+        SMCR( SMCR && ) = delete;
+
+        SMCR( SMCR const & ) = delete;
+
+        ~SMCR() = delete;
+
+        auto operator=( SMCR && ) = delete;
+
+        auto operator=( SMCR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief MCU Status Register (MCUSR) register.
+     *
+     * This register has the following fields:
+     * - Power-on Reset Flag (PORF)
+     * - External Reset Flag (EXTRF)
+     * - Brown-out Reset Flag (BORF)
+     * - Watchdog System Reset Flag (WDRF)
+     * - JTAG Reset Flag (JTRF) (ATmega2560 only, reserved on the ATmega328/P)
+     */
+    class MCUSR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto PORF      = std::uint_fast8_t{ 1 }; ///< PORF.
+            static constexpr auto EXTRF     = std::uint_fast8_t{ 1 }; ///< EXTRF.
+            static constexpr auto BORF      = std::uint_fast8_t{ 1 }; ///< BORF.
+            static constexpr auto WDRF      = std::uint_fast8_t{ 1 }; ///< WDRF.
+            static constexpr auto JTRF      = std::uint_fast8_t{ 1 }; ///< JTRF.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ 3 }; ///< RESERVED5.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto PORF = std::uint_fast8_t{}; ///< PORF.
+            static constexpr auto EXTRF = std::uint_fast8_t{ PORF + Size::PORF }; ///< EXTRF.
+            static constexpr auto BORF = std::uint_fast8_t{ EXTRF + Size::EXTRF }; ///< BORF.
+            static constexpr auto WDRF = std::uint_fast8_t{ BORF + Size::BORF }; ///< WDRF.
+            static constexpr auto JTRF = std::uint_fast8_t{ WDRF + Size::WDRF }; ///< JTRF.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ JTRF + Size::JTRF }; ///< RESERVED5.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto PORF = mask<std::uint8_t>( Size::PORF, Bit::PORF ); ///< PORF.
+            static constexpr auto EXTRF = mask<std::uint8_t>( Size::EXTRF, Bit::EXTRF ); ///< EXTRF.
+            static constexpr auto BORF = mask<std::uint8_t>( Size::BORF, Bit::BORF ); ///< BORF.
+            static constexpr auto WDRF = mask<std::uint8_t>( Size::WDRF, Bit::WDRF ); ///< WDRF.
+            static constexpr auto JTRF = mask<std::uint8_t>( Size::JTRF, Bit::JTRF ); ///< JTRF.
+            static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+        };
+
+        MCUSR() = delete;
+
+        MCUSR( MCUSR && ) = delete;
+
+        MCUSR( MCUSR const & ) = delete;
+
+        ~MCUSR() = delete;
+
+        auto operator=( MCUSR && ) = delete;
+
+        auto operator=( MCUSR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief MCU Control Register (MCUCR) register.
+     *
+     * This register has the following fields:
+     * - Interrupt Vector Change Enable (IVCE)
+     * - Interrupt Vector Select (IVSEL)
+     * - Pull-up Disable (PUD)
+     * - BOD Sleep Enable (BODSE) (ATmega328/P only, reserved on the ATmega2560)
+     * - BOD Sleep (BODS) (ATmega328/P only, reserved on the ATmega2560)
+     * - JTAG Interface Disable (JTD) (ATmega2560 only, reserved on the ATmega328/P)
+     */
+    class MCUCR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto IVCE      = std::uint_fast8_t{ 1 }; ///< IVCE.
+            static constexpr auto IVSEL     = std::uint_fast8_t{ 1 }; ///< IVSEL.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ 2 }; ///< RESERVED2.
+            static constexpr auto PUD       = std::uint_fast8_t{ 1 }; ///< PUD.
+            static constexpr auto BODSE     = std::uint_fast8_t{ 1 }; ///< BODSE.
+            static constexpr auto BODS      = std::uint_fast8_t{ 1 }; ///< BODS.
+            static constexpr auto JTD       = std::uint_fast8_t{ 1 }; ///< JTD.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto IVCE = std::uint_fast8_t{}; ///< IVCE.
+            static constexpr auto IVSEL = std::uint_fast8_t{ IVCE + Size::IVCE }; ///< IVSEL.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ IVSEL + Size::IVSEL }; ///< RESERVED2.
+            static constexpr auto PUD = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< PUD.
+            static constexpr auto BODSE = std::uint_fast8_t{ PUD + Size::PUD }; ///< BODSE.
+            static constexpr auto BODS = std::uint_fast8_t{ BODSE + Size::BODSE }; ///< BODS.
+            static constexpr auto JTD = std::uint_fast8_t{ BODS + Size::BODS }; ///< JTD.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto IVCE = mask<std::uint8_t>( Size::IVCE, Bit::IVCE ); ///< IVCE.
+            static constexpr auto IVSEL = mask<std::uint8_t>( Size::IVSEL, Bit::IVSEL ); ///< IVSEL.
+            static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto PUD = mask<std::uint8_t>( Size::PUD, Bit::PUD ); ///< PUD.
+            static constexpr auto BODSE = mask<std::uint8_t>( Size::BODSE, Bit::BODSE ); ///< BODSE.
+            static constexpr auto BODS = mask<std::uint8_t>( Size::BODS, Bit::BODS ); ///< BODS.
+            static constexpr auto JTD = mask<std::uint8_t>( Size::JTD, Bit::JTD ); ///< JTD.
+        };
+
+        MCUCR() = delete;
+
+        MCUCR( MCUCR && ) = delete;
+
+        MCUCR( MCUCR const & ) = delete;
+
+        ~MCUCR() = delete;
+
+        auto operator=( MCUCR && ) = delete;
+
+        auto operator=( MCUCR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Store Program Memory Control and Status Register (SPMCSR) register.
+     *
+     * This register has the following fields:
+     * - Store Program Memory Enable (SPMEN) (SELFPRGEN on the ATmega328/P)
+     * - Page Erase (PGERS)
+     * - Page Write (PGWRT)
+     * - Boot Lock Bit Set (BLBSET)
+     * - Read-While-Write Section Read Enable (RWWSRE)
+     * - Signature Row Read (SIGRD)
+     * - Read-While-Write Section Busy (RWWSB)
+     * - SPM Interrupt Enable (SPMIE)
+     */
+    class SPMCSR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SPMEN  = std::uint_fast8_t{ 1 }; ///< SPMEN.
+            static constexpr auto PGERS  = std::uint_fast8_t{ 1 }; ///< PGERS.
+            static constexpr auto PGWRT  = std::uint_fast8_t{ 1 }; ///< PGWRT.
+            static constexpr auto BLBSET = std::uint_fast8_t{ 1 }; ///< BLBSET.
+            static constexpr auto RWWSRE = std::uint_fast8_t{ 1 }; ///< RWWSRE.
+            static constexpr auto SIGRD  = std::uint_fast8_t{ 1 }; ///< SIGRD.
+            static constexpr auto RWWSB  = std::uint_fast8_t{ 1 }; ///< RWWSB.
+            static constexpr auto SPMIE  = std::uint_fast8_t{ 1 }; ///< SPMIE.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SPMEN = std::uint_fast8_t{}; ///< SPMEN.
+            static constexpr auto PGERS = std::uint_fast8_t{ SPMEN + Size::SPMEN }; ///< PGERS.
+            static constexpr auto PGWRT = std::uint_fast8_t{ PGERS + Size::PGERS }; ///< PGWRT.
+            static constexpr auto BLBSET = std::uint_fast8_t{ PGWRT + Size::PGWRT }; ///< BLBSET.
+            static constexpr auto RWWSRE = std::uint_fast8_t{ BLBSET + Size::BLBSET }; ///< RWWSRE.
+            static constexpr auto SIGRD = std::uint_fast8_t{ RWWSRE + Size::RWWSRE }; ///< SIGRD.
+            static constexpr auto RWWSB = std::uint_fast8_t{ SIGRD + Size::SIGRD }; ///< RWWSB.
+            static constexpr auto SPMIE = std::uint_fast8_t{ RWWSB + Size::RWWSB }; ///< SPMIE.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SPMEN = mask<std::uint8_t>( Size::SPMEN, Bit::SPMEN ); ///< SPMEN.
+            static constexpr auto PGERS = mask<std::uint8_t>( Size::PGERS, Bit::PGERS ); ///< PGERS.
+            static constexpr auto PGWRT = mask<std::uint8_t>( Size::PGWRT, Bit::PGWRT ); ///< PGWRT.
+            static constexpr auto BLBSET = mask<std::uint8_t>( Size::BLBSET, Bit::BLBSET ); ///< BLBSET.
+            static constexpr auto RWWSRE = mask<std::uint8_t>( Size::RWWSRE, Bit::RWWSRE ); ///< RWWSRE.
+            static constexpr auto SIGRD = mask<std::uint8_t>( Size::SIGRD, Bit::SIGRD ); ///< SIGRD.
+            static constexpr auto RWWSB = mask<std::uint8_t>( Size::RWWSB, Bit::RWWSB ); ///< RWWSB.
+            static constexpr auto SPMIE = mask<std::uint8_t>( Size::SPMIE, Bit::SPMIE ); ///< SPMIE.
+        };
+
+        SPMCSR() = delete;
+
+        SPMCSR( SPMCSR && ) = delete;
+
+        SPMCSR( SPMCSR const & ) = delete;
+
+        ~SPMCSR() = delete;
+
+        auto operator=( SPMCSR && ) = delete;
+
+        auto operator=( SPMCSR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Status Register (SREG) register.
+     *
+     * This register has the following fields:
+     * - Carry Flag (C)
+     * - Zero Flag (Z)
+     * - Negative Flag (N)
+     * - Two's Complement Overflow Flag (V)
+     * - Sign Flag (S)
+     * - Half Carry Flag (H)
+     * - Bit Copy Storage (T)
+     * - Global Interrupt Enable (I)
+     */
+    class SREG : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto C = std::uint_fast8_t{ 1 }; ///< C.
+            static constexpr auto Z = std::uint_fast8_t{ 1 }; ///< Z.
+            static constexpr auto N = std::uint_fast8_t{ 1 }; ///< N.
+            static constexpr auto V = std::uint_fast8_t{ 1 }; ///< V.
+            static constexpr auto S = std::uint_fast8_t{ 1 }; ///< S.
+            static constexpr auto H = std::uint_fast8_t{ 1 }; ///< H.
+            static constexpr auto T = std::uint_fast8_t{ 1 }; ///< T.
+            static constexpr auto I = std::uint_fast8_t{ 1 }; ///< I.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto C = std::uint_fast8_t{}; ///< C.
+            static constexpr auto Z = std::uint_fast8_t{ C + Size::C }; ///< Z.
+            static constexpr auto N = std::uint_fast8_t{ Z + Size::Z }; ///< N.
+            static constexpr auto V = std::uint_fast8_t{ N + Size::N }; ///< V.
+            static constexpr auto S = std::uint_fast8_t{ V + Size::V }; ///< S.
+            static constexpr auto H = std::uint_fast8_t{ S + Size::S }; ///< H.
+            static constexpr auto T = std::uint_fast8_t{ H + Size::H }; ///< T.
+            static constexpr auto I = std::uint_fast8_t{ T + Size::T }; ///< I.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto C = mask<std::uint8_t>( Size::C, Bit::C ); ///< C.
+            static constexpr auto Z = mask<std::uint8_t>( Size::Z, Bit::Z ); ///< Z.
+            static constexpr auto N = mask<std::uint8_t>( Size::N, Bit::N ); ///< N.
+            static constexpr auto V = mask<std::uint8_t>( Size::V, Bit::V ); ///< V.
+            static constexpr auto S = mask<std::uint8_t>( Size::S, Bit::S ); ///< S.
+            static constexpr auto H = mask<std::uint8_t>( Size::H, Bit::H ); ///< H.
+            static constexpr auto T = mask<std::uint8_t>( Size::T, Bit::T ); ///< T.
+            static constexpr auto I = mask<std::uint8_t>( Size::I, Bit::I ); ///< I.
+        };
+
+        SREG() = delete;
+
+        SREG( SREG && ) = delete;
+
+        SREG( SREG const & ) = delete;
+
+        ~SREG() = delete;
+
+        auto operator=( SREG && ) = delete;
+
+        auto operator=( SREG const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief SMCR.
+     */
+    SMCR smcr;
+
+    /**
+     * \brief MCUSR.
+     */
+    MCUSR mcusr;
+
+    /**
+     * \brief MCUCR.
+     */
+    MCUCR mcucr;
+
+    /**
+     * \brief Reserved registers.
+     */
+    Reserved_Register<std::uint8_t> const reserved0[ 1 ];
+
+    /**
+     * \brief SPMCSR.
+     */
+    SPMCSR spmcsr;
+
+    /**
+     * \brief Reserved registers.
+     */
+    Reserved_Register<std::uint8_t> const reserved1[ 3 ];
+
+    /**
+     * \brief Extended Z-pointer Register for ELPM/SPM (RAMPZ) (ATmega2560 only, reserved on
+     *        the ATmega328/P).
+     */
+    Register<std::uint8_t> rampz;
+
+    /**
+     * \brief Extended Indirect Register (EIND) (ATmega2560 only, reserved on the
+     *        ATmega328/P).
+     */
+    Register<std::uint8_t> eind;
+
+    /**
+     * \brief Stack Pointer (SP).
+     */
+    Register<std::uint16_t> sp;
+
+    /**
+     * \brief SREG.
+     */
+    SREG sreg;
+
+    CPU() = delete;
+
+    CPU( CPU && ) = delete;
+
+    CPU( CPU const & ) = delete;
+
+    ~CPU() = delete;
+
+    auto operator=( CPU && ) = delete;
+
+    auto operator=( CPU const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_CPU_H
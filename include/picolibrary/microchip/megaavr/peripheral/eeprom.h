@@ -0,0 +1,140 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Peripheral::EEPROM interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_EEPROM_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_EEPROM_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::megaAVR::Peripheral {
+
+/**
+ * \brief Microchip megaAVR EEPROM peripheral.
+ */
+class EEPROM {
+  public:
+    /**
+     * \brief EEPROM Control Register (EECR) register.
+     *
+     * This register has the following fields:
+     * - EEPROM Read Enable (EERE)
+     * - EEPROM Programming Enable (EEPE)
+     * - EEPROM Master Programming Enable (EEMPE)
+     * - EEPROM Ready Interrupt Enable (EERIE)
+     * - EEPROM Programming Mode Bits (EEPM)
+     */
+    class EECR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto EERE      = std::uint_fast8_t{ 1 }; ///< EERE.
+            static constexpr auto EEPE      = std::uint_fast8_t{ 1 }; ///< EEPE.
+            static constexpr auto EEMPE     = std::uint_fast8_t{ 1 }; ///< EEMPE.
+            static constexpr auto EERIE     = std::uint_fast8_t{ 1 }; ///< EERIE.
+            static constexpr auto EEPM      = std::uint_fast8_t{ 2 }; ///< EEPM.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto EERE = std::uint_fast8_t{}; ///< EERE.
+            static constexpr auto EEPE = std::uint_fast8_t{ EERE + Size::EERE }; ///< EEPE.
+            static constexpr auto EEMPE = std::uint_fast8_t{ EEPE + Size::EEPE }; ///< EEMPE.
+            static constexpr auto EERIE = std::uint_fast8_t{ EEMPE + Size::EEMPE }; ///< EERIE.
+            static constexpr auto EEPM = std::uint_fast8_t{ EERIE + Size::EERIE }; ///< EEPM.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ EEPM + Size::EEPM }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto EERE = mask<std::uint8_t>( Size::EERE, Bit::EERE ); ///< EERE.
+            static constexpr auto EEPE = mask<std::uint8_t>( Size::EEPE, Bit::EEPE ); ///< EEPE.
+            static constexpr auto EEMPE = mask<std::uint8_t>( Size::EEMPE, Bit::EEMPE ); ///< EEMPE.
+            static constexpr auto EERIE = mask<std::uint8_t>( Size::EERIE, Bit::EERIE ); ///< EERIE.
+            static constexpr auto EEPM = mask<std::uint8_t>( Size::EEPM, Bit::EEPM ); ///< EEPM.
+            static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+        };
+
+        /**
+         * \brief Programming mode.
+         */
+        enum EEPM : std::uint8_t {
+            EEPM_ERASE_AND_WRITE = 0b00 << Bit::EEPM, ///< Erase and write in one operation (atomic operation).
+            EEPM_ERASE_ONLY = 0b01 << Bit::EEPM, ///< Erase only.
+            EEPM_WRITE_ONLY = 0b10 << Bit::EEPM, ///< Write only.
+        };
+
+        EECR() = delete;
+
+        EECR( EECR && ) = delete;
+
+        EECR( EECR const & ) = delete;
+
+        ~EECR() = delete;
+
+        auto operator=( EECR && ) = delete;
+
+        auto operator=( EECR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief EECR.
+     */
+    EECR eecr;
+
+    /**
+     * \brief EEPROM Data Register (EEDR).
+     */
+    Register<std::uint8_t> eedr;
+
+    /**
+     * \brief EEPROM Address Register (EEAR).
+     */
+    Register<std::uint16_t> eear;
+
+    EEPROM() = delete;
+
+    EEPROM( EEPROM && ) = delete;
+
+    EEPROM( EEPROM const & ) = delete;
+
+    ~EEPROM() = delete;
+
+    auto operator=( EEPROM && ) = delete;
+
+    auto operator=( EEPROM const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_EEPROM_H
@@ -0,0 +1,337 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Peripheral::SYSCTRL interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_SYSCTRL_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_SYSCTRL_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::megaAVR::Peripheral {
+
+/**
+ * \brief Microchip megaAVR SYSCTRL (watchdog, system clock, and power reduction control)
+ *        peripheral.
+ */
+class SYSCTRL {
+  public:
+    /**
+     * \brief Watchdog Timer Control Register (WDTCSR) register.
+     *
+     * This register has the following fields:
+     * - Watchdog Timer Prescaler Bits 0-2 (WDP)
+     * - Watchdog System Reset Enable (WDE)
+     * - Watchdog Change Enable (WDCE)
+     * - Watchdog Timer Prescaler Bit 3 (WDP3)
+     * - Watchdog Interrupt Enable (WDIE)
+     * - Watchdog Interrupt Flag (WDIF)
+     */
+    class WDTCSR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto WDP  = std::uint_fast8_t{ 3 }; ///< WDP.
+            static constexpr auto WDE  = std::uint_fast8_t{ 1 }; ///< WDE.
+            static constexpr auto WDCE = std::uint_fast8_t{ 1 }; ///< WDCE.
+            static constexpr auto WDP3 = std::uint_fast8_t{ 1 }; ///< WDP3.
+            static constexpr auto WDIE = std::uint_fast8_t{ 1 }; ///< WDIE.
+            static constexpr auto WDIF = std::uint_fast8_t{ 1 }; ///< WDIF.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto WDP = std::uint_fast8_t{}; ///< WDP.
+            static constexpr auto WDE = std::uint_fast8_t{ WDP + Size::WDP }; ///< WDE.
+            static constexpr auto WDCE = std::uint_fast8_t{ WDE + Size::WDE }; ///< WDCE.
+            static constexpr auto WDP3 = std::uint_fast8_t{ WDCE + Size::WDCE }; ///< WDP3.
+            static constexpr auto WDIE = std::uint_fast8_t{ WDP3 + Size::WDP3 }; ///< WDIE.
+            static constexpr auto WDIF = std::uint_fast8_t{ WDIE + Size::WDIE }; ///< WDIF.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto WDP = mask<std::uint8_t>( Size::WDP, Bit::WDP ); ///< WDP.
+            static constexpr auto WDE = mask<std::uint8_t>( Size::WDE, Bit::WDE ); ///< WDE.
+            static constexpr auto WDCE = mask<std::uint8_t>( Size::WDCE, Bit::WDCE ); ///< WDCE.
+            static constexpr auto WDP3 = mask<std::uint8_t>( Size::WDP3, Bit::WDP3 ); ///< WDP3.
+            static constexpr auto WDIE = mask<std::uint8_t>( Size::WDIE, Bit::WDIE ); ///< WDIE.
+            static constexpr auto WDIF = mask<std::uint8_t>( Size::WDIF, Bit::WDIF ); ///< WDIF.
+        };
+
+        WDTCSR() = delete;
+
+        WDTCSR( WDTCSR && ) = delete;
+
+        WDTCSR( WDTCSR const & ) = delete;
+
+        ~WDTCSR() = delete;
+
+        auto operator=( WDTCSR && ) = delete;
+
+        auto operator=( WDTCSR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Clock Prescale Register (CLKPR) register.
+     *
+     * This register has the following fields:
+     * - Clock Prescaler Select Bits (CLKPS)
+     * - Clock Prescaler Change Enable (CLKPCE)
+     */
+    class CLKPR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CLKPS     = std::uint_fast8_t{ 4 }; ///< CLKPS.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 3 }; ///< RESERVED4.
+            static constexpr auto CLKPCE    = std::uint_fast8_t{ 1 }; ///< CLKPCE.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CLKPS = std::uint_fast8_t{}; ///< CLKPS.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ CLKPS + Size::CLKPS }; ///< RESERVED4.
+            static constexpr auto CLKPCE = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< CLKPCE.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CLKPS = mask<std::uint8_t>( Size::CLKPS, Bit::CLKPS ); ///< CLKPS.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto CLKPCE = mask<std::uint8_t>( Size::CLKPCE, Bit::CLKPCE ); ///< CLKPCE.
+        };
+
+        CLKPR() = delete;
+
+        CLKPR( CLKPR && ) = delete;
+
+        CLKPR( CLKPR const & ) = delete;
+
+        ~CLKPR() = delete;
+
+        auto operator=( CLKPR && ) = delete;
+
+        auto operator=( CLKPR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Power Reduction Register 0 (PRR0) (PRR on the ATmega328/P) register.
+     *
+     * This register has the following fields:
+     * - Power Reduction ADC (PRADC)
+     * - Power Reduction USART0 (PRUSART0)
+     * - Power Reduction Serial Peripheral Interface (PRSPI)
+     * - Power Reduction Timer/Counter1 (PRTIM1)
+     * - Power Reduction Timer/Counter0 (PRTIM0)
+     * - Power Reduction Timer/Counter2 (PRTIM2)
+     * - Power Reduction TWI (PRTWI)
+     */
+    class PRR0 : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto PRADC     = std::uint_fast8_t{ 1 }; ///< PRADC.
+            static constexpr auto PRUSART0  = std::uint_fast8_t{ 1 }; ///< PRUSART0.
+            static constexpr auto PRSPI     = std::uint_fast8_t{ 1 }; ///< PRSPI.
+            static constexpr auto PRTIM1    = std::uint_fast8_t{ 1 }; ///< PRTIM1.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 1 }; ///< RESERVED4.
+            static constexpr auto PRTIM0    = std::uint_fast8_t{ 1 }; ///< PRTIM0.
+            static constexpr auto PRTIM2    = std::uint_fast8_t{ 1 }; ///< PRTIM2.
+            static constexpr auto PRTWI     = std::uint_fast8_t{ 1 }; ///< PRTWI.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto PRADC = std::uint_fast8_t{}; ///< PRADC.
+            static constexpr auto PRUSART0 = std::uint_fast8_t{ PRADC + Size::PRADC }; ///< PRUSART0.
+            static constexpr auto PRSPI = std::uint_fast8_t{ PRUSART0 + Size::PRUSART0 }; ///< PRSPI.
+            static constexpr auto PRTIM1 = std::uint_fast8_t{ PRSPI + Size::PRSPI }; ///< PRTIM1.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ PRTIM1 + Size::PRTIM1 }; ///< RESERVED4.
+            static constexpr auto PRTIM0 = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< PRTIM0.
+            static constexpr auto PRTIM2 = std::uint_fast8_t{ PRTIM0 + Size::PRTIM0 }; ///< PRTIM2.
+            static constexpr auto PRTWI = std::uint_fast8_t{ PRTIM2 + Size::PRTIM2 }; ///< PRTWI.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto PRADC = mask<std::uint8_t>( Size::PRADC, Bit::PRADC ); ///< PRADC.
+            static constexpr auto PRUSART0 = mask<std::uint8_t>( Size::PRUSART0, Bit::PRUSART0 ); ///< PRUSART0.
+            static constexpr auto PRSPI = mask<std::uint8_t>( Size::PRSPI, Bit::PRSPI ); ///< PRSPI.
+            static constexpr auto PRTIM1 = mask<std::uint8_t>( Size::PRTIM1, Bit::PRTIM1 ); ///< PRTIM1.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto PRTIM0 = mask<std::uint8_t>( Size::PRTIM0, Bit::PRTIM0 ); ///< PRTIM0.
+            static constexpr auto PRTIM2 = mask<std::uint8_t>( Size::PRTIM2, Bit::PRTIM2 ); ///< PRTIM2.
+            static constexpr auto PRTWI = mask<std::uint8_t>( Size::PRTWI, Bit::PRTWI ); ///< PRTWI.
+        };
+
+        PRR0() = delete;
+
+        PRR0( PRR0 && ) = delete;
+
+        PRR0( PRR0 const & ) = delete;
+
+        ~PRR0() = delete;
+
+        auto operator=( PRR0 && ) = delete;
+
+        auto operator=( PRR0 const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Power Reduction Register 1 (PRR1) (ATmega2560 only) register.
+     *
+     * This register has the following fields:
+     * - Power Reduction USART1 (PRUSART1)
+     * - Power Reduction USART2 (PRUSART2)
+     * - Power Reduction USART3 (PRUSART3)
+     * - Power Reduction Timer/Counter3 (PRTIM3)
+     * - Power Reduction Timer/Counter4 (PRTIM4)
+     * - Power Reduction Timer/Counter5 (PRTIM5)
+     */
+    class PRR1 : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto PRUSART1  = std::uint_fast8_t{ 1 }; ///< PRUSART1.
+            static constexpr auto PRUSART2  = std::uint_fast8_t{ 1 }; ///< PRUSART2.
+            static constexpr auto PRUSART3  = std::uint_fast8_t{ 1 }; ///< PRUSART3.
+            static constexpr auto PRTIM3    = std::uint_fast8_t{ 1 }; ///< PRTIM3.
+            static constexpr auto PRTIM4    = std::uint_fast8_t{ 1 }; ///< PRTIM4.
+            static constexpr auto PRTIM5    = std::uint_fast8_t{ 1 }; ///< PRTIM5.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto PRUSART1 = std::uint_fast8_t{}; ///< PRUSART1.
+            static constexpr auto PRUSART2 = std::uint_fast8_t{ PRUSART1 + Size::PRUSART1 }; ///< PRUSART2.
+            static constexpr auto PRUSART3 = std::uint_fast8_t{ PRUSART2 + Size::PRUSART2 }; ///< PRUSART3.
+            static constexpr auto PRTIM3 = std::uint_fast8_t{ PRUSART3 + Size::PRUSART3 }; ///< PRTIM3.
+            static constexpr auto PRTIM4 = std::uint_fast8_t{ PRTIM3 + Size::PRTIM3 }; ///< PRTIM4.
+            static constexpr auto PRTIM5 = std::uint_fast8_t{ PRTIM4 + Size::PRTIM4 }; ///< PRTIM5.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ PRTIM5 + Size::PRTIM5 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto PRUSART1 = mask<std::uint8_t>( Size::PRUSART1, Bit::PRUSART1 ); ///< PRUSART1.
+            static constexpr auto PRUSART2 = mask<std::uint8_t>( Size::PRUSART2, Bit::PRUSART2 ); ///< PRUSART2.
+            static constexpr auto PRUSART3 = mask<std::uint8_t>( Size::PRUSART3, Bit::PRUSART3 ); ///< PRUSART3.
+            static constexpr auto PRTIM3 = mask<std::uint8_t>( Size::PRTIM3, Bit::PRTIM3 ); ///< PRTIM3.
+            static constexpr auto PRTIM4 = mask<std::uint8_t>( Size::PRTIM4, Bit::PRTIM4 ); ///< PRTIM4.
+            static constexpr auto PRTIM5 = mask<std::uint8_t>( Size::PRTIM5, Bit::PRTIM5 ); ///< PRTIM5.
+            static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+        };
+
+        PRR1() = delete;
+
+        PRR1( PRR1 && ) = delete;
+
+        PRR1( PRR1 const & ) = delete;
+
+        ~PRR1() = delete;
+
+        auto operator=( PRR1 && ) = delete;
+
+        auto operator=( PRR1 const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief WDTCSR.
+     */
+    WDTCSR wdtcsr;
+
+    /**
+     * \brief CLKPR.
+     */
+    CLKPR clkpr;
+
+    /**
+     * \brief Reserved registers.
+     */
+    Reserved_Register<std::uint8_t> const reserved0[ 2 ];
+
+    /**
+     * \brief PRR0.
+     */
+    PRR0 prr0;
+
+    /**
+     * \brief PRR1 (ATmega2560 only, reserved on the ATmega328/P).
+     */
+    PRR1 prr1;
+
+    /**
+     * \brief Oscillator Calibration Register (OSCCAL).
+     */
+    Register<std::uint8_t> osccal;
+
+    SYSCTRL() = delete;
+
+    SYSCTRL( SYSCTRL && ) = delete;
+
+    SYSCTRL( SYSCTRL const & ) = delete;
+
+    ~SYSCTRL() = delete;
+
+    auto operator=( SYSCTRL && ) = delete;
+
+    auto operator=( SYSCTRL const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_SYSCTRL_H
@@ -0,0 +1,421 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Peripheral::TC16 interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC16_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC16_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::megaAVR::Peripheral {
+
+/**
+ * \brief Microchip megaAVR 16-bit Timer/Counter (TC16) peripheral.
+ *
+ * \attention The TIMSK and TIFR registers associated with a TC16 peripheral are not part
+ *            of the peripheral's register block. Their layouts are defined by the
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC16::TIMSK and
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC16::TIFR classes, and MCU
+ *            specific instances of them are defined alongside the TC16 peripheral
+ *            instances.
+ */
+class TC16 {
+  public:
+    /**
+     * \brief Timer/Counter Control Register A (TCCRA) register.
+     *
+     * This register has the following fields:
+     * - Waveform Generation Mode (WGM)
+     * - Compare Output Mode for Channel C (COMC) (ATmega2560 only)
+     * - Compare Output Mode for Channel B (COMB)
+     * - Compare Output Mode for Channel A (COMA)
+     */
+    class TCCRA : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto WGM  = std::uint_fast8_t{ 2 }; ///< WGM.
+            static constexpr auto COMC = std::uint_fast8_t{ 2 }; ///< COMC.
+            static constexpr auto COMB = std::uint_fast8_t{ 2 }; ///< COMB.
+            static constexpr auto COMA = std::uint_fast8_t{ 2 }; ///< COMA.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto WGM = std::uint_fast8_t{}; ///< WGM.
+            static constexpr auto COMC = std::uint_fast8_t{ WGM + Size::WGM }; ///< COMC.
+            static constexpr auto COMB = std::uint_fast8_t{ COMC + Size::COMC }; ///< COMB.
+            static constexpr auto COMA = std::uint_fast8_t{ COMB + Size::COMB }; ///< COMA.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto WGM = mask<std::uint8_t>( Size::WGM, Bit::WGM ); ///< WGM.
+            static constexpr auto COMC = mask<std::uint8_t>( Size::COMC, Bit::COMC ); ///< COMC.
+            static constexpr auto COMB = mask<std::uint8_t>( Size::COMB, Bit::COMB ); ///< COMB.
+            static constexpr auto COMA = mask<std::uint8_t>( Size::COMA, Bit::COMA ); ///< COMA.
+        };
+
+        TCCRA() = delete;
+
+        TCCRA( TCCRA && ) = delete;
+
+        TCCRA( TCCRA const & ) = delete;
+
+        ~TCCRA() = delete;
+
+        auto operator=( TCCRA && ) = delete;
+
+        auto operator=( TCCRA const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Timer/Counter Control Register B (TCCRB) register.
+     *
+     * This register has the following fields:
+     * - Clock Select (CS)
+     * - Waveform Generation Mode (WGM)
+     * - Input Capture Edge Select (ICES)
+     * - Input Capture Noise Canceler (ICNC)
+     */
+    class TCCRB : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CS        = std::uint_fast8_t{ 3 }; ///< CS.
+            static constexpr auto WGM       = std::uint_fast8_t{ 2 }; ///< WGM.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ 1 }; ///< RESERVED5.
+            static constexpr auto ICES      = std::uint_fast8_t{ 1 }; ///< ICES.
+            static constexpr auto ICNC      = std::uint_fast8_t{ 1 }; ///< ICNC.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CS = std::uint_fast8_t{}; ///< CS.
+            static constexpr auto WGM = std::uint_fast8_t{ CS + Size::CS }; ///< WGM.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ WGM + Size::WGM }; ///< RESERVED5.
+            static constexpr auto ICES = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< ICES.
+            static constexpr auto ICNC = std::uint_fast8_t{ ICES + Size::ICES }; ///< ICNC.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CS = mask<std::uint8_t>( Size::CS, Bit::CS ); ///< CS.
+            static constexpr auto WGM = mask<std::uint8_t>( Size::WGM, Bit::WGM ); ///< WGM.
+            static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+            static constexpr auto ICES = mask<std::uint8_t>( Size::ICES, Bit::ICES ); ///< ICES.
+            static constexpr auto ICNC = mask<std::uint8_t>( Size::ICNC, Bit::ICNC ); ///< ICNC.
+        };
+
+        /**
+         * \brief CS.
+         */
+        enum CS : std::uint8_t {
+            CS_NONE = 0b000 << Bit::CS, ///< No clock source (timer/counter stopped).
+            CS_CLK_IO_1 = 0b001 << Bit::CS, ///< clk_I/O / 1.
+            CS_CLK_IO_8 = 0b010 << Bit::CS, ///< clk_I/O / 8.
+            CS_CLK_IO_64 = 0b011 << Bit::CS, ///< clk_I/O / 64.
+            CS_CLK_IO_256 = 0b100 << Bit::CS, ///< clk_I/O / 256.
+            CS_CLK_IO_1024 = 0b101 << Bit::CS, ///< clk_I/O / 1024.
+            CS_EXTERNAL_FALLING_EDGE = 0b110 << Bit::CS, ///< External clock source on Tn pin, falling edge.
+            CS_EXTERNAL_RISING_EDGE = 0b111 << Bit::CS, ///< External clock source on Tn pin, rising edge.
+        };
+
+        TCCRB() = delete;
+
+        TCCRB( TCCRB && ) = delete;
+
+        TCCRB( TCCRB const & ) = delete;
+
+        ~TCCRB() = delete;
+
+        auto operator=( TCCRB && ) = delete;
+
+        auto operator=( TCCRB const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Timer/Counter Control Register C (TCCRC) register.
+     *
+     * This register has the following fields:
+     * - Force Output Compare for Channel C (FOCC) (ATmega2560 only)
+     * - Force Output Compare for Channel B (FOCB)
+     * - Force Output Compare for Channel A (FOCA)
+     */
+    class TCCRC : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto RESERVED0 = std::uint_fast8_t{ 5 }; ///< RESERVED0.
+            static constexpr auto FOCC      = std::uint_fast8_t{ 1 }; ///< FOCC.
+            static constexpr auto FOCB      = std::uint_fast8_t{ 1 }; ///< FOCB.
+            static constexpr auto FOCA      = std::uint_fast8_t{ 1 }; ///< FOCA.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+            static constexpr auto FOCC = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< FOCC.
+            static constexpr auto FOCB = std::uint_fast8_t{ FOCC + Size::FOCC }; ///< FOCB.
+            static constexpr auto FOCA = std::uint_fast8_t{ FOCB + Size::FOCB }; ///< FOCA.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto RESERVED0 = mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+            static constexpr auto FOCC = mask<std::uint8_t>( Size::FOCC, Bit::FOCC ); ///< FOCC.
+            static constexpr auto FOCB = mask<std::uint8_t>( Size::FOCB, Bit::FOCB ); ///< FOCB.
+            static constexpr auto FOCA = mask<std::uint8_t>( Size::FOCA, Bit::FOCA ); ///< FOCA.
+        };
+
+        TCCRC() = delete;
+
+        TCCRC( TCCRC && ) = delete;
+
+        TCCRC( TCCRC const & ) = delete;
+
+        ~TCCRC() = delete;
+
+        auto operator=( TCCRC && ) = delete;
+
+        auto operator=( TCCRC const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Timer/Counter Interrupt Mask Register (TIMSK) register.
+     *
+     * This register has the following fields:
+     * - Timer/Counter Overflow Interrupt Enable (TOIE)
+     * - Timer/Counter Output Compare A Match Interrupt Enable (OCIEA)
+     * - Timer/Counter Output Compare B Match Interrupt Enable (OCIEB)
+     * - Timer/Counter Output Compare C Match Interrupt Enable (OCIEC) (ATmega2560 only)
+     * - Timer/Counter Input Capture Interrupt Enable (ICIE)
+     */
+    class TIMSK : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TOIE      = std::uint_fast8_t{ 1 }; ///< TOIE.
+            static constexpr auto OCIEA     = std::uint_fast8_t{ 1 }; ///< OCIEA.
+            static constexpr auto OCIEB     = std::uint_fast8_t{ 1 }; ///< OCIEB.
+            static constexpr auto OCIEC     = std::uint_fast8_t{ 1 }; ///< OCIEC.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 1 }; ///< RESERVED4.
+            static constexpr auto ICIE      = std::uint_fast8_t{ 1 }; ///< ICIE.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TOIE = std::uint_fast8_t{}; ///< TOIE.
+            static constexpr auto OCIEA = std::uint_fast8_t{ TOIE + Size::TOIE }; ///< OCIEA.
+            static constexpr auto OCIEB = std::uint_fast8_t{ OCIEA + Size::OCIEA }; ///< OCIEB.
+            static constexpr auto OCIEC = std::uint_fast8_t{ OCIEB + Size::OCIEB }; ///< OCIEC.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ OCIEC + Size::OCIEC }; ///< RESERVED4.
+            static constexpr auto ICIE = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< ICIE.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ ICIE + Size::ICIE }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TOIE = mask<std::uint8_t>( Size::TOIE, Bit::TOIE ); ///< TOIE.
+            static constexpr auto OCIEA = mask<std::uint8_t>( Size::OCIEA, Bit::OCIEA ); ///< OCIEA.
+            static constexpr auto OCIEB = mask<std::uint8_t>( Size::OCIEB, Bit::OCIEB ); ///< OCIEB.
+            static constexpr auto OCIEC = mask<std::uint8_t>( Size::OCIEC, Bit::OCIEC ); ///< OCIEC.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto ICIE = mask<std::uint8_t>( Size::ICIE, Bit::ICIE ); ///< ICIE.
+            static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+        };
+
+        TIMSK() = delete;
+
+        TIMSK( TIMSK && ) = delete;
+
+        TIMSK( TIMSK const & ) = delete;
+
+        ~TIMSK() = delete;
+
+        auto operator=( TIMSK && ) = delete;
+
+        auto operator=( TIMSK const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Timer/Counter Interrupt Flag Register (TIFR) register.
+     *
+     * This register has the following fields:
+     * - Timer/Counter Overflow Flag (TOV)
+     * - Timer/Counter Output Compare A Match Flag (OCFA)
+     * - Timer/Counter Output Compare B Match Flag (OCFB)
+     * - Timer/Counter Output Compare C Match Flag (OCFC) (ATmega2560 only)
+     * - Timer/Counter Input Capture Flag (ICF)
+     */
+    class TIFR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TOV       = std::uint_fast8_t{ 1 }; ///< TOV.
+            static constexpr auto OCFA      = std::uint_fast8_t{ 1 }; ///< OCFA.
+            static constexpr auto OCFB      = std::uint_fast8_t{ 1 }; ///< OCFB.
+            static constexpr auto OCFC      = std::uint_fast8_t{ 1 }; ///< OCFC.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 1 }; ///< RESERVED4.
+            static constexpr auto ICF       = std::uint_fast8_t{ 1 }; ///< ICF.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TOV = std::uint_fast8_t{}; ///< TOV.
+            static constexpr auto OCFA = std::uint_fast8_t{ TOV + Size::TOV }; ///< OCFA.
+            static constexpr auto OCFB = std::uint_fast8_t{ OCFA + Size::OCFA }; ///< OCFB.
+            static constexpr auto OCFC = std::uint_fast8_t{ OCFB + Size::OCFB }; ///< OCFC.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ OCFC + Size::OCFC }; ///< RESERVED4.
+            static constexpr auto ICF = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< ICF.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ ICF + Size::ICF }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TOV = mask<std::uint8_t>( Size::TOV, Bit::TOV ); ///< TOV.
+            static constexpr auto OCFA = mask<std::uint8_t>( Size::OCFA, Bit::OCFA ); ///< OCFA.
+            static constexpr auto OCFB = mask<std::uint8_t>( Size::OCFB, Bit::OCFB ); ///< OCFB.
+            static constexpr auto OCFC = mask<std::uint8_t>( Size::OCFC, Bit::OCFC ); ///< OCFC.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto ICF = mask<std::uint8_t>( Size::ICF, Bit::ICF ); ///< ICF.
+            static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+        };
+
+        TIFR() = delete;
+
+        TIFR( TIFR && ) = delete;
+
+        TIFR( TIFR const & ) = delete;
+
+        ~TIFR() = delete;
+
+        auto operator=( TIFR && ) = delete;
+
+        auto operator=( TIFR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief TCCRA.
+     */
+    TCCRA tccra;
+
+    /**
+     * \brief TCCRB.
+     */
+    TCCRB tccrb;
+
+    /**
+     * \brief TCCRC.
+     */
+    TCCRC tccrc;
+
+    /**
+     * \brief Reserved registers.
+     */
+    Reserved_Register<std::uint8_t> const reserved[ 1 ];
+
+    /**
+     * \brief Timer/Counter Register (TCNT).
+     */
+    Register<std::uint16_t> tcnt;
+
+    /**
+     * \brief Input Capture Register (ICR).
+     */
+    Register<std::uint16_t> icr;
+
+    /**
+     * \brief Output Compare Register A (OCRA).
+     */
+    Register<std::uint16_t> ocra;
+
+    /**
+     * \brief Output Compare Register B (OCRB).
+     */
+    Register<std::uint16_t> ocrb;
+
+    /**
+     * \brief Output Compare Register C (OCRC) (ATmega2560 only).
+     */
+    Register<std::uint16_t> ocrc;
+
+    TC16() = delete;
+
+    TC16( TC16 && ) = delete;
+
+    TC16( TC16 const & ) = delete;
+
+    ~TC16() = delete;
+
+    auto operator=( TC16 && ) = delete;
+
+    auto operator=( TC16 const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC16_H
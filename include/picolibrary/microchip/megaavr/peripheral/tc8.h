@@ -0,0 +1,323 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Peripheral::TC8 interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC8_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC8_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::megaAVR::Peripheral {
+
+/**
+ * \brief Microchip megaAVR 8-bit Timer/Counter (TC8) peripheral.
+ *
+ * \attention The TIMSK and TIFR registers associated with a TC8 peripheral are not part
+ *            of the peripheral's register block. Their layouts are defined by the
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC8::TIMSK and
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC8::TIFR classes, and MCU
+ *            specific instances of them are defined alongside the TC8 peripheral
+ *            instances.
+ */
+class TC8 {
+  public:
+    /**
+     * \brief Timer/Counter Control Register A (TCCRA) register.
+     *
+     * This register has the following fields:
+     * - Waveform Generation Mode Bits 0-1 (WGM)
+     * - Compare Output Mode for Channel B (COMB)
+     * - Compare Output Mode for Channel A (COMA)
+     */
+    class TCCRA : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto WGM       = std::uint_fast8_t{ 2 }; ///< WGM.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ 2 }; ///< RESERVED2.
+            static constexpr auto COMB      = std::uint_fast8_t{ 2 }; ///< COMB.
+            static constexpr auto COMA      = std::uint_fast8_t{ 2 }; ///< COMA.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto WGM = std::uint_fast8_t{}; ///< WGM.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ WGM + Size::WGM }; ///< RESERVED2.
+            static constexpr auto COMB = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< COMB.
+            static constexpr auto COMA = std::uint_fast8_t{ COMB + Size::COMB }; ///< COMA.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto WGM = mask<std::uint8_t>( Size::WGM, Bit::WGM ); ///< WGM.
+            static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto COMB = mask<std::uint8_t>( Size::COMB, Bit::COMB ); ///< COMB.
+            static constexpr auto COMA = mask<std::uint8_t>( Size::COMA, Bit::COMA ); ///< COMA.
+        };
+
+        TCCRA() = delete;
+
+        TCCRA( TCCRA && ) = delete;
+
+        TCCRA( TCCRA const & ) = delete;
+
+        ~TCCRA() = delete;
+
+        auto operator=( TCCRA && ) = delete;
+
+        auto operator=( TCCRA const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Timer/Counter Control Register B (TCCRB) register.
+     *
+     * This register has the following fields:
+     * - Clock Select (CS)
+     * - Waveform Generation Mode Bit 2 (WGM2)
+     * - Force Output Compare for Channel B (FOCB)
+     * - Force Output Compare for Channel A (FOCA)
+     */
+    class TCCRB : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CS        = std::uint_fast8_t{ 3 }; ///< CS.
+            static constexpr auto WGM2      = std::uint_fast8_t{ 1 }; ///< WGM2.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 2 }; ///< RESERVED4.
+            static constexpr auto FOCB      = std::uint_fast8_t{ 1 }; ///< FOCB.
+            static constexpr auto FOCA      = std::uint_fast8_t{ 1 }; ///< FOCA.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CS = std::uint_fast8_t{}; ///< CS.
+            static constexpr auto WGM2 = std::uint_fast8_t{ CS + Size::CS }; ///< WGM2.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ WGM2 + Size::WGM2 }; ///< RESERVED4.
+            static constexpr auto FOCB = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< FOCB.
+            static constexpr auto FOCA = std::uint_fast8_t{ FOCB + Size::FOCB }; ///< FOCA.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CS = mask<std::uint8_t>( Size::CS, Bit::CS ); ///< CS.
+            static constexpr auto WGM2 = mask<std::uint8_t>( Size::WGM2, Bit::WGM2 ); ///< WGM2.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto FOCB = mask<std::uint8_t>( Size::FOCB, Bit::FOCB ); ///< FOCB.
+            static constexpr auto FOCA = mask<std::uint8_t>( Size::FOCA, Bit::FOCA ); ///< FOCA.
+        };
+
+        /**
+         * \brief Clock sources.
+         */
+        enum CS : std::uint8_t {
+            CS_NONE = 0b000 << Bit::CS, ///< No clock source (timer/counter stopped).
+            CS_CLK_IO_1 = 0b001 << Bit::CS, ///< clk_I/O / 1.
+            CS_CLK_IO_8 = 0b010 << Bit::CS, ///< clk_I/O / 8.
+            CS_CLK_IO_64 = 0b011 << Bit::CS, ///< clk_I/O / 64.
+            CS_CLK_IO_256 = 0b100 << Bit::CS, ///< clk_I/O / 256.
+            CS_CLK_IO_1024 = 0b101 << Bit::CS, ///< clk_I/O / 1024.
+            CS_EXTERNAL_FALLING_EDGE = 0b110 << Bit::CS, ///< External clock source on Tn pin, falling edge.
+            CS_EXTERNAL_RISING_EDGE = 0b111 << Bit::CS, ///< External clock source on Tn pin, rising edge.
+        };
+
+        TCCRB() = delete;
+
+        TCCRB( TCCRB && ) = delete;
+
+        TCCRB( TCCRB const & ) = delete;
+
+        ~TCCRB() = delete;
+
+        auto operator=( TCCRB && ) = delete;
+
+        auto operator=( TCCRB const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Timer/Counter Interrupt Mask Register (TIMSK) register.
+     *
+     * This register has the following fields:
+     * - Timer/Counter Overflow Interrupt Enable (TOIE)
+     * - Timer/Counter Output Compare A Match Interrupt Enable (OCIEA)
+     * - Timer/Counter Output Compare B Match Interrupt Enable (OCIEB)
+     */
+    class TIMSK : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TOIE      = std::uint_fast8_t{ 1 }; ///< TOIE.
+            static constexpr auto OCIEA     = std::uint_fast8_t{ 1 }; ///< OCIEA.
+            static constexpr auto OCIEB     = std::uint_fast8_t{ 1 }; ///< OCIEB.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TOIE = std::uint_fast8_t{}; ///< TOIE.
+            static constexpr auto OCIEA = std::uint_fast8_t{ TOIE + Size::TOIE }; ///< OCIEA.
+            static constexpr auto OCIEB = std::uint_fast8_t{ OCIEA + Size::OCIEA }; ///< OCIEB.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ OCIEB + Size::OCIEB }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TOIE = mask<std::uint8_t>( Size::TOIE, Bit::TOIE ); ///< TOIE.
+            static constexpr auto OCIEA = mask<std::uint8_t>( Size::OCIEA, Bit::OCIEA ); ///< OCIEA.
+            static constexpr auto OCIEB = mask<std::uint8_t>( Size::OCIEB, Bit::OCIEB ); ///< OCIEB.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        TIMSK() = delete;
+
+        TIMSK( TIMSK && ) = delete;
+
+        TIMSK( TIMSK const & ) = delete;
+
+        ~TIMSK() = delete;
+
+        auto operator=( TIMSK && ) = delete;
+
+        auto operator=( TIMSK const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Timer/Counter Interrupt Flag Register (TIFR) register.
+     *
+     * This register has the following fields:
+     * - Timer/Counter Overflow Flag (TOV)
+     * - Timer/Counter Output Compare A Match Flag (OCFA)
+     * - Timer/Counter Output Compare B Match Flag (OCFB)
+     */
+    class TIFR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TOV       = std::uint_fast8_t{ 1 }; ///< TOV.
+            static constexpr auto OCFA      = std::uint_fast8_t{ 1 }; ///< OCFA.
+            static constexpr auto OCFB      = std::uint_fast8_t{ 1 }; ///< OCFB.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TOV = std::uint_fast8_t{}; ///< TOV.
+            static constexpr auto OCFA = std::uint_fast8_t{ TOV + Size::TOV }; ///< OCFA.
+            static constexpr auto OCFB = std::uint_fast8_t{ OCFA + Size::OCFA }; ///< OCFB.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ OCFB + Size::OCFB }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TOV = mask<std::uint8_t>( Size::TOV, Bit::TOV ); ///< TOV.
+            static constexpr auto OCFA = mask<std::uint8_t>( Size::OCFA, Bit::OCFA ); ///< OCFA.
+            static constexpr auto OCFB = mask<std::uint8_t>( Size::OCFB, Bit::OCFB ); ///< OCFB.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        TIFR() = delete;
+
+        TIFR( TIFR && ) = delete;
+
+        TIFR( TIFR const & ) = delete;
+
+        ~TIFR() = delete;
+
+        auto operator=( TIFR && ) = delete;
+
+        auto operator=( TIFR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief TCCRA.
+     */
+    TCCRA tccra;
+
+    /**
+     * \brief TCCRB.
+     */
+    TCCRB tccrb;
+
+    /**
+     * \brief Timer/Counter Register (TCNT).
+     */
+    Register<std::uint8_t> tcnt;
+
+    /**
+     * \brief Output Compare Register A (OCRA).
+     */
+    Register<std::uint8_t> ocra;
+
+    /**
+     * \brief Output Compare Register B (OCRB).
+     */
+    Register<std::uint8_t> ocrb;
+
+    TC8() = delete;
+
+    TC8( TC8 && ) = delete;
+
+    TC8( TC8 const & ) = delete;
+
+    ~TC8() = delete;
+
+    auto operator=( TC8 && ) = delete;
+
+    auto operator=( TC8 const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC8_H
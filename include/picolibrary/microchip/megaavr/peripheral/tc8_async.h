@@ -0,0 +1,246 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Peripheral::TC8_ASYNC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC8_ASYNC_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC8_ASYNC_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc8.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::megaAVR::Peripheral {
+
+/**
+ * \brief Microchip megaAVR 8-bit Timer/Counter with asynchronous operation (TC8_ASYNC)
+ *        peripheral.
+ *
+ * \attention The TIMSK and TIFR registers associated with a TC8_ASYNC peripheral are
+ *            not part of the peripheral's register block. Their layouts are defined by
+ *            the picolibrary::Microchip::megaAVR::Peripheral::TC8::TIMSK and
+ *            picolibrary::Microchip::megaAVR::Peripheral::TC8::TIFR classes, and MCU
+ *            specific instances of them are defined alongside the TC8_ASYNC peripheral
+ *            instances.
+ */
+class TC8_ASYNC {
+  public:
+    /**
+     * \brief Timer/Counter Control Register A (TCCRA) register.
+     */
+    using TCCRA = TC8::TCCRA;
+
+    /**
+     * \brief Timer/Counter Control Register B (TCCRB) register.
+     *
+     * This register has the following fields:
+     * - Clock Select (CS)
+     * - Waveform Generation Mode Bit 2 (WGM2)
+     * - Force Output Compare for Channel B (FOCB)
+     * - Force Output Compare for Channel A (FOCA)
+     */
+    class TCCRB : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CS        = std::uint_fast8_t{ 3 }; ///< CS.
+            static constexpr auto WGM2      = std::uint_fast8_t{ 1 }; ///< WGM2.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 2 }; ///< RESERVED4.
+            static constexpr auto FOCB      = std::uint_fast8_t{ 1 }; ///< FOCB.
+            static constexpr auto FOCA      = std::uint_fast8_t{ 1 }; ///< FOCA.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CS = std::uint_fast8_t{}; ///< CS.
+            static constexpr auto WGM2 = std::uint_fast8_t{ CS + Size::CS }; ///< WGM2.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ WGM2 + Size::WGM2 }; ///< RESERVED4.
+            static constexpr auto FOCB = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< FOCB.
+            static constexpr auto FOCA = std::uint_fast8_t{ FOCB + Size::FOCB }; ///< FOCA.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CS = mask<std::uint8_t>( Size::CS, Bit::CS ); ///< CS.
+            static constexpr auto WGM2 = mask<std::uint8_t>( Size::WGM2, Bit::WGM2 ); ///< WGM2.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto FOCB = mask<std::uint8_t>( Size::FOCB, Bit::FOCB ); ///< FOCB.
+            static constexpr auto FOCA = mask<std::uint8_t>( Size::FOCA, Bit::FOCA ); ///< FOCA.
+        };
+
+        /**
+         * \brief Clock sources.
+         */
+        enum CS : std::uint8_t {
+            CS_NONE = 0b000 << Bit::CS, ///< No clock source (timer/counter stopped).
+            CS_CLK_TS_1 = 0b001 << Bit::CS, ///< clk_TS / 1.
+            CS_CLK_TS_8 = 0b010 << Bit::CS, ///< clk_TS / 8.
+            CS_CLK_TS_32 = 0b011 << Bit::CS, ///< clk_TS / 32.
+            CS_CLK_TS_64 = 0b100 << Bit::CS, ///< clk_TS / 64.
+            CS_CLK_TS_128 = 0b101 << Bit::CS, ///< clk_TS / 128.
+            CS_CLK_TS_256 = 0b110 << Bit::CS, ///< clk_TS / 256.
+            CS_CLK_TS_1024 = 0b111 << Bit::CS, ///< clk_TS / 1024.
+        };
+
+        TCCRB() = delete;
+
+        TCCRB( TCCRB && ) = delete;
+
+        TCCRB( TCCRB const & ) = delete;
+
+        ~TCCRB() = delete;
+
+        auto operator=( TCCRB && ) = delete;
+
+        auto operator=( TCCRB const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Asynchronous Status Register (ASSR) register.
+     *
+     * This register has the following fields:
+     * - Timer/Counter Control Register B Update Busy (TCRBUB)
+     * - Timer/Counter Control Register A Update Busy (TCRAUB)
+     * - Output Compare Register B Update Busy (OCRBUB)
+     * - Output Compare Register A Update Busy (OCRAUB)
+     * - Timer/Counter Update Busy (TCNUB)
+     * - Asynchronous Timer/Counter (AS)
+     * - Enable External Clock Input (EXCLK)
+     */
+    class ASSR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TCRBUB    = std::uint_fast8_t{ 1 }; ///< TCRBUB.
+            static constexpr auto TCRAUB    = std::uint_fast8_t{ 1 }; ///< TCRAUB.
+            static constexpr auto OCRBUB    = std::uint_fast8_t{ 1 }; ///< OCRBUB.
+            static constexpr auto OCRAUB    = std::uint_fast8_t{ 1 }; ///< OCRAUB.
+            static constexpr auto TCNUB     = std::uint_fast8_t{ 1 }; ///< TCNUB.
+            static constexpr auto AS        = std::uint_fast8_t{ 1 }; ///< AS.
+            static constexpr auto EXCLK     = std::uint_fast8_t{ 1 }; ///< EXCLK.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TCRBUB = std::uint_fast8_t{}; ///< TCRBUB.
+            static constexpr auto TCRAUB = std::uint_fast8_t{ TCRBUB + Size::TCRBUB }; ///< TCRAUB.
+            static constexpr auto OCRBUB = std::uint_fast8_t{ TCRAUB + Size::TCRAUB }; ///< OCRBUB.
+            static constexpr auto OCRAUB = std::uint_fast8_t{ OCRBUB + Size::OCRBUB }; ///< OCRAUB.
+            static constexpr auto TCNUB = std::uint_fast8_t{ OCRAUB + Size::OCRAUB }; ///< TCNUB.
+            static constexpr auto AS = std::uint_fast8_t{ TCNUB + Size::TCNUB }; ///< AS.
+            static constexpr auto EXCLK = std::uint_fast8_t{ AS + Size::AS }; ///< EXCLK.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ EXCLK + Size::EXCLK }; ///< RESERVED7.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TCRBUB = mask<std::uint8_t>( Size::TCRBUB, Bit::TCRBUB ); ///< TCRBUB.
+            static constexpr auto TCRAUB = mask<std::uint8_t>( Size::TCRAUB, Bit::TCRAUB ); ///< TCRAUB.
+            static constexpr auto OCRBUB = mask<std::uint8_t>( Size::OCRBUB, Bit::OCRBUB ); ///< OCRBUB.
+            static constexpr auto OCRAUB = mask<std::uint8_t>( Size::OCRAUB, Bit::OCRAUB ); ///< OCRAUB.
+            static constexpr auto TCNUB = mask<std::uint8_t>( Size::TCNUB, Bit::TCNUB ); ///< TCNUB.
+            static constexpr auto AS = mask<std::uint8_t>( Size::AS, Bit::AS ); ///< AS.
+            static constexpr auto EXCLK = mask<std::uint8_t>( Size::EXCLK, Bit::EXCLK ); ///< EXCLK.
+            static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+        };
+
+        ASSR() = delete;
+
+        ASSR( ASSR && ) = delete;
+
+        ASSR( ASSR const & ) = delete;
+
+        ~ASSR() = delete;
+
+        auto operator=( ASSR && ) = delete;
+
+        auto operator=( ASSR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief TCCRA.
+     */
+    TCCRA tccra;
+
+    /**
+     * \brief TCCRB.
+     */
+    TCCRB tccrb;
+
+    /**
+     * \brief Timer/Counter Register (TCNT).
+     */
+    Register<std::uint8_t> tcnt;
+
+    /**
+     * \brief Output Compare Register A (OCRA).
+     */
+    Register<std::uint8_t> ocra;
+
+    /**
+     * \brief Output Compare Register B (OCRB).
+     */
+    Register<std::uint8_t> ocrb;
+
+    /**
+     * \brief Reserved registers.
+     */
+    Reserved_Register<std::uint8_t> const reserved[ 1 ];
+
+    /**
+     * \brief ASSR.
+     */
+    ASSR assr;
+
+    TC8_ASYNC() = delete;
+
+    TC8_ASYNC( TC8_ASYNC && ) = delete;
+
+    TC8_ASYNC( TC8_ASYNC const & ) = delete;
+
+    ~TC8_ASYNC() = delete;
+
+    auto operator=( TC8_ASYNC && ) = delete;
+
+    auto operator=( TC8_ASYNC const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PERIPHERAL_TC8_ASYNC_H
@@ -0,0 +1,303 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Power interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_POWER_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_POWER_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Microchip megaAVR power management facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Power {
+
+/**
+ * \brief Sleep mode.
+ */
+enum class Sleep_Mode : std::uint8_t {
+    IDLE                = Peripheral::CPU::SMCR::SM_IDLE,                ///< Idle.
+    ADC_NOISE_REDUCTION = Peripheral::CPU::SMCR::SM_ADC_NOISE_REDUCTION, ///< ADC noise reduction.
+    POWER_DOWN          = Peripheral::CPU::SMCR::SM_POWER_DOWN,          ///< Power-down.
+    POWER_SAVE          = Peripheral::CPU::SMCR::SM_POWER_SAVE,          ///< Power-save.
+    STANDBY             = Peripheral::CPU::SMCR::SM_STANDBY,             ///< Standby.
+    EXTENDED_STANDBY    = Peripheral::CPU::SMCR::SM_EXTENDED_STANDBY,    ///< Extended standby.
+};
+
+/**
+ * \brief Enable interrupts and sleep until an interrupt occurs.
+ *
+ * \param[in] cpu The CPU peripheral.
+ * \param[in] sleep_mode The sleep mode to use.
+ *
+ * \post interrupts are enabled
+ */
+inline void sleep( Peripheral::CPU & cpu, Sleep_Mode sleep_mode ) noexcept
+{
+    cpu.smcr = to_underlying( sleep_mode ) | Peripheral::CPU::SMCR::Mask::SE;
+
+    // the instruction following sei is executed before any pending interrupt, so an
+    // interrupt that occurs after interrupts are enabled always wakes the CPU
+    asm volatile( "sei\n\tsleep" ::: "memory" );
+
+    cpu.smcr = to_underlying( sleep_mode );
+}
+
+/**
+ * \brief Sleep until a condition is true.
+ *
+ * The condition is checked with interrupts disabled, and the CPU is put to sleep without
+ * enabling interrupts in between, so an interrupt that makes the condition true cannot be
+ * missed.
+ *
+ * \tparam Condition The type of condition to wait for.
+ *
+ * \param[in] cpu The CPU peripheral.
+ * \param[in] sleep_mode The sleep mode to use.
+ * \param[in] condition The condition to wait for (only made true by interrupts).
+ *
+ * \post interrupts are enabled
+ */
+template<typename Condition>
+void sleep_until( Peripheral::CPU & cpu, Sleep_Mode sleep_mode, Condition condition ) noexcept
+{
+    auto interrupt_controller = Interrupt::Controller{};
+
+    for ( ;; ) {
+        interrupt_controller.disable_interrupt();
+
+        if ( condition() ) {
+            interrupt_controller.enable_interrupt();
+
+            return;
+        } // if
+
+        sleep( cpu, sleep_mode );
+    } // for
+}
+
+/**
+ * \brief Power reduction module.
+ */
+enum class Module : std::uint8_t {
+    ADC    = Peripheral::SYSCTRL::PRR0::Bit::PRADC,    ///< ADC.
+    USART0 = Peripheral::SYSCTRL::PRR0::Bit::PRUSART0, ///< USART0.
+    SPI    = Peripheral::SYSCTRL::PRR0::Bit::PRSPI,    ///< SPI.
+    TC1    = Peripheral::SYSCTRL::PRR0::Bit::PRTIM1,   ///< TC1.
+    TC0    = Peripheral::SYSCTRL::PRR0::Bit::PRTIM0,   ///< TC0.
+    TC2    = Peripheral::SYSCTRL::PRR0::Bit::PRTIM2,   ///< TC2.
+    TWI    = Peripheral::SYSCTRL::PRR0::Bit::PRTWI,    ///< TWI.
+#if defined( __AVR_ATmega2560__ )
+    USART1 = 8 + Peripheral::SYSCTRL::PRR1::Bit::PRUSART1, ///< USART1.
+    USART2 = 8 + Peripheral::SYSCTRL::PRR1::Bit::PRUSART2, ///< USART2.
+    USART3 = 8 + Peripheral::SYSCTRL::PRR1::Bit::PRUSART3, ///< USART3.
+    TC3    = 8 + Peripheral::SYSCTRL::PRR1::Bit::PRTIM3,   ///< TC3.
+    TC4    = 8 + Peripheral::SYSCTRL::PRR1::Bit::PRTIM4,   ///< TC4.
+    TC5    = 8 + Peripheral::SYSCTRL::PRR1::Bit::PRTIM5,   ///< TC5.
+#endif // defined( __AVR_ATmega2560__ )
+};
+
+/**
+ * \brief Lookup a USART peripheral's power reduction module.
+ *
+ * \param[in] usart_address The address of the USART peripheral whose power reduction
+ *            module is to be looked up.
+ *
+ * \return The USART peripheral's power reduction module.
+ */
+constexpr auto usart_module( std::uintptr_t usart_address ) noexcept -> Module
+{
+    switch ( usart_address ) {
+        case Peripheral::USART0::ADDRESS: return Module::USART0;
+#if defined( __AVR_ATmega2560__ )
+        case Peripheral::USART1::ADDRESS: return Module::USART1;
+        case Peripheral::USART2::ADDRESS: return Module::USART2;
+        case Peripheral::USART3::ADDRESS: return Module::USART3;
+#endif // defined( __AVR_ATmega2560__ )
+    } // switch
+
+    PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Lookup a TC16 peripheral's power reduction module.
+ *
+ * \param[in] tc16_address The address of the TC16 peripheral whose power reduction
+ *            module is to be looked up.
+ *
+ * \return The TC16 peripheral's power reduction module.
+ */
+constexpr auto tc16_module( std::uintptr_t tc16_address ) noexcept -> Module
+{
+    switch ( tc16_address ) {
+        case Peripheral::TC1::ADDRESS: return Module::TC1;
+#if defined( __AVR_ATmega2560__ )
+        case Peripheral::TC3::ADDRESS: return Module::TC3;
+        case Peripheral::TC4::ADDRESS: return Module::TC4;
+        case Peripheral::TC5::ADDRESS: return Module::TC5;
+#endif // defined( __AVR_ATmega2560__ )
+    } // switch
+
+    PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Lookup a USART peripheral's power reduction module.
+ *
+ * \param[in] usart The USART peripheral whose power reduction module is to be looked up.
+ *
+ * \return The USART peripheral's power reduction module.
+ */
+inline auto module( Peripheral::USART const & usart ) noexcept -> Module
+{
+    return usart_module( reinterpret_cast<std::uintptr_t>( &usart ) );
+}
+
+/**
+ * \brief Lookup an SPI peripheral's power reduction module.
+ *
+ * \return The SPI peripheral's power reduction module.
+ */
+constexpr auto module( Peripheral::SPI const & ) noexcept -> Module
+{
+    return Module::SPI;
+}
+
+/**
+ * \brief Lookup a TWI peripheral's power reduction module.
+ *
+ * \return The TWI peripheral's power reduction module.
+ */
+constexpr auto module( Peripheral::TWI const & ) noexcept -> Module
+{
+    return Module::TWI;
+}
+
+/**
+ * \brief Lookup an ADC peripheral's power reduction module.
+ *
+ * \return The ADC peripheral's power reduction module.
+ */
+constexpr auto module( Peripheral::ADC const & ) noexcept -> Module
+{
+    return Module::ADC;
+}
+
+/**
+ * \brief Lookup a TC16 peripheral's power reduction module.
+ *
+ * \param[in] tc16 The TC16 peripheral whose power reduction module is to be looked up.
+ *
+ * \return The TC16 peripheral's power reduction module.
+ */
+inline auto module( Peripheral::TC16 const & tc16 ) noexcept -> Module
+{
+    return tc16_module( reinterpret_cast<std::uintptr_t>( &tc16 ) );
+}
+
+/**
+ * \brief Lookup a TC8 peripheral's power reduction module.
+ *
+ * \return The TC8 peripheral's power reduction module.
+ */
+constexpr auto module( Peripheral::TC8 const & ) noexcept -> Module
+{
+    return Module::TC0;
+}
+
+/**
+ * \brief Lookup a TC8_ASYNC peripheral's power reduction module.
+ *
+ * \return The TC8_ASYNC peripheral's power reduction module.
+ */
+constexpr auto module( Peripheral::TC8_ASYNC const & ) noexcept -> Module
+{
+    return Module::TC2;
+}
+
+/**
+ * \brief Acquire a reference to a module, powering the module up if it was not
+ *        referenced.
+ *
+ * \param[in] module The module to acquire a reference to.
+ */
+void acquire( Module module ) noexcept;
+
+/**
+ * \brief Acquire a reference to a peripheral's module, powering the module up if it was
+ *        not referenced.
+ *
+ * \tparam Peripheral_Type The type of peripheral whose module a reference is to be
+ *         acquired to.
+ *
+ * \param[in] peripheral The peripheral whose module a reference is to be acquired to.
+ */
+template<typename Peripheral_Type>
+void acquire( Peripheral_Type const & peripheral ) noexcept
+{
+    acquire( module( peripheral ) );
+}
+
+/**
+ * \brief Release a reference to a module, powering the module down if it is no longer
+ *        referenced.
+ *
+ * \param[in] module The module to release a reference to.
+ *
+ * \pre the module is referenced
+ */
+void release( Module module ) noexcept;
+
+/**
+ * \brief Release a reference to a peripheral's module, powering the module down if it is
+ *        no longer referenced.
+ *
+ * \tparam Peripheral_Type The type of peripheral whose module a reference is to be
+ *         released to.
+ *
+ * \param[in] peripheral The peripheral whose module a reference is to be released to.
+ *
+ * \pre the peripheral's module is referenced
+ */
+template<typename Peripheral_Type>
+void release( Peripheral_Type const & peripheral ) noexcept
+{
+    release( module( peripheral ) );
+}
+
+/**
+ * \brief Power down all modules that are not referenced.
+ *
+ * \attention Modules that are used without a driver that references them must be
+ *            referenced using picolibrary::Microchip::megaAVR::Power::acquire() before
+ *            this function is called.
+ */
+void power_down_unreferenced_modules() noexcept;
+
+} // namespace picolibrary::Microchip::megaAVR::Power
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_POWER_H
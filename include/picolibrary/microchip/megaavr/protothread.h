@@ -0,0 +1,311 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Protothread interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/interrupt.h"
+
+/**
+ * \brief Microchip megaAVR protothread facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Protothread {
+
+/**
+ * \brief Protothread state.
+ */
+enum class State : std::uint8_t {
+    WAITING, ///< Waiting (the protothread must be called again to resume it).
+    EXITED,  ///< Exited.
+};
+
+/**
+ * \brief Protothread context (the point a protothread resumes from).
+ *
+ * Protothreads are stackless, so local variables are not preserved across waits.
+ * Variables that must be preserved across waits should be stored in the object that
+ * stores the protothread's context.
+ */
+class Context {
+  public:
+    /**
+     * \brief Resume point.
+     */
+    using Resume_Point = std::uint16_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Context() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Context( Context && source ) noexcept = default;
+
+    Context( Context const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Context() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Context && expression ) noexcept -> Context & = default;
+
+    auto operator=( Context const & ) = delete;
+
+    /**
+     * \brief Get the point the protothread resumes from.
+     *
+     * \return The point the protothread resumes from.
+     */
+    constexpr auto resume_point() const noexcept -> Resume_Point
+    {
+        return m_resume_point;
+    }
+
+    /**
+     * \brief Set the point the protothread resumes from.
+     *
+     * \param[in] resume_point The point the protothread resumes from.
+     */
+    constexpr void set_resume_point( Resume_Point resume_point ) noexcept
+    {
+        m_resume_point = resume_point;
+    }
+
+    /**
+     * \brief Check if the protothread has exited.
+     *
+     * \return true if the protothread has exited.
+     * \return false if the protothread has not exited.
+     */
+    constexpr auto is_exited() const noexcept -> bool
+    {
+        return m_resume_point == EXITED;
+    }
+
+    /**
+     * \brief Mark the protothread as exited (calling an exited protothread has no
+     *        effect).
+     */
+    constexpr void exit() noexcept
+    {
+        m_resume_point = EXITED;
+    }
+
+    /**
+     * \brief Reset the context (the protothread restarts from the beginning the next time
+     *        it is called).
+     */
+    constexpr void reset() noexcept
+    {
+        m_resume_point = 0;
+    }
+
+  private:
+    /**
+     * \brief The exited resume point.
+     */
+    static constexpr auto EXITED = Resume_Point{ 0xFFFF };
+
+    /**
+     * \brief The point the protothread resumes from.
+     */
+    Resume_Point m_resume_point{};
+};
+
+/**
+ * \brief Completion event (signaled from an ISR, awaited by a protothread).
+ */
+class Event {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Event() noexcept = default;
+
+    Event( Event && ) = delete;
+
+    Event( Event const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Event() noexcept = default;
+
+    auto operator=( Event && ) = delete;
+
+    auto operator=( Event const & ) = delete;
+
+    /**
+     * \brief Signal the event.
+     */
+    void signal() noexcept
+    {
+        m_is_signaled = true;
+    }
+
+    /**
+     * \brief Check if the event has been signaled.
+     *
+     * \return true if the event has been signaled.
+     * \return false if the event has not been signaled.
+     */
+    auto is_signaled() const noexcept -> bool
+    {
+        return m_is_signaled;
+    }
+
+    /**
+     * \brief Clear the event.
+     */
+    void clear() noexcept
+    {
+        m_is_signaled = false;
+    }
+
+    /**
+     * \brief Clear the event if it has been signaled.
+     *
+     * \return true if the event had been signaled.
+     * \return false if the event had not been signaled.
+     */
+    auto consume() noexcept -> bool
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        bool const is_signaled = m_is_signaled;
+
+        m_is_signaled = false;
+
+        return is_signaled;
+    }
+
+  private:
+    /**
+     * \brief The event's signaled flag.
+     */
+    bool volatile m_is_signaled{};
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Protothread
+
+/**
+ * \brief Begin a protothread's body.
+ *
+ * \relatedalso picolibrary::Microchip::megaAVR::Protothread::Context
+ *
+ * \param[in] context The protothread's context.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_BEGIN( context ) \
+    switch ( ( context ).resume_point() ) {                        \
+        case 0:
+
+/**
+ * \brief Suspend a protothread until it is next called.
+ *
+ * \relatedalso picolibrary::Microchip::megaAVR::Protothread::Context
+ *
+ * \attention Only one protothread wait macro may be used per source line.
+ *
+ * \param[in] context The protothread's context.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_YIELD( context )             \
+    do {                                                                       \
+        ( context ).set_resume_point( __LINE__ );                              \
+        return ::picolibrary::Microchip::megaAVR::Protothread::State::WAITING; \
+        case __LINE__:;                                                        \
+    } while ( false )
+
+/**
+ * \brief Suspend a protothread until a condition is true.
+ *
+ * \relatedalso picolibrary::Microchip::megaAVR::Protothread::Context
+ *
+ * \attention Only one protothread wait macro may be used per source line.
+ *
+ * \param[in] context The protothread's context.
+ * \param[in] condition The condition to wait for (evaluated each time the protothread is
+ *            called until it is true).
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_AWAIT( context, condition )          \
+    do {                                                                               \
+        ( context ).set_resume_point( __LINE__ );                                      \
+        [[fallthrough]];                                                               \
+        case __LINE__:                                                                 \
+            if ( not( condition ) ) {                                                  \
+                return ::picolibrary::Microchip::megaAVR::Protothread::State::WAITING; \
+            }                                                                          \
+    } while ( false )
+
+/**
+ * \brief Suspend a protothread until an event is signaled (the event is cleared when the
+ *        protothread resumes).
+ *
+ * \relatedalso picolibrary::Microchip::megaAVR::Protothread::Event
+ *
+ * \attention Only one protothread wait macro may be used per source line.
+ *
+ * \param[in] context The protothread's context.
+ * \param[in] event The event to wait for.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_AWAIT_EVENT( context, event ) \
+    PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_AWAIT( context, ( event ).consume() )
+
+/**
+ * \brief Exit a protothread.
+ *
+ * \relatedalso picolibrary::Microchip::megaAVR::Protothread::Context
+ *
+ * \param[in] context The protothread's context.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_EXIT( context )             \
+    do {                                                                      \
+        ( context ).exit();                                                   \
+        return ::picolibrary::Microchip::megaAVR::Protothread::State::EXITED; \
+    } while ( false )
+
+/**
+ * \brief End a protothread's body.
+ *
+ * \relatedalso picolibrary::Microchip::megaAVR::Protothread::Context
+ *
+ * \param[in] context The protothread's context.
+ */
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_END( context ) \
+    }                                                            \
+    ( context ).exit();                                          \
+    return ::picolibrary::Microchip::megaAVR::Protothread::State::EXITED
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_PROTOTHREAD_H
@@ -0,0 +1,448 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::RTC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_RTC_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_RTC_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc8.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc8_async.h"
+#include "picolibrary/microchip/megaavr/power.h"
+
+/**
+ * \brief Microchip megaAVR real-time clock facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::RTC {
+
+/**
+ * \brief Sub-second ticks (1/256 s).
+ */
+using Ticks = std::uint32_t;
+
+/**
+ * \brief The number of ticks per second.
+ */
+constexpr auto TICKS_PER_SECOND = Ticks{ 256 };
+
+/**
+ * \brief Time.
+ */
+struct Time {
+    /**
+     * \brief Seconds.
+     */
+    std::uint32_t seconds;
+
+    /**
+     * \brief Sub-second ticks (1/256 s).
+     */
+    std::uint8_t ticks;
+};
+
+/**
+ * \brief Real-time clock service.
+ *
+ * The service clocks a TC8_ASYNC peripheral (TC2) asynchronously from a 32.768 kHz watch
+ * crystal connected to the TOSC1/TOSC2 pins. The counter is prescaled by 128, so it
+ * counts sub-second ticks (1/256 s) and overflows once per second. Since the
+ * asynchronous clock keeps running in power-save mode, the time keeps counting while the
+ * CPU sleeps.
+ *
+ * \attention The TC8_ASYNC peripheral must not be used for anything else while the
+ *            service exists.
+ */
+class Service {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Service() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] tc8_async The TC8_ASYNC peripheral to be used by the service.
+     * \param[in] timsk The TC8_ASYNC peripheral's TIMSK register.
+     * \param[in] tifr The TC8_ASYNC peripheral's TIFR register.
+     */
+    Service(
+        Peripheral::TC8_ASYNC &  tc8_async,
+        Peripheral::TC8::TIMSK & timsk,
+        Peripheral::TC8::TIFR &  tifr ) noexcept :
+        m_tc8_async{ &tc8_async },
+        m_timsk{ &timsk },
+        m_tifr{ &tifr }
+    {
+        Power::acquire( tc8_async );
+    }
+
+    Service( Service && ) = delete;
+
+    Service( Service const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Service() noexcept
+    {
+        disable();
+    }
+
+    auto operator=( Service && ) = delete;
+
+    auto operator=( Service const & ) = delete;
+
+    /**
+     * \brief Initialize the service's hardware.
+     *
+     * The TC8_ASYNC peripheral is switched to asynchronous operation using the sequence
+     * specified by the datasheet (interrupts disabled, AS set, registers written, update
+     * busy flags polled, interrupt flags cleared), and the overflow interrupt is enabled.
+     *
+     * \attention The crystal oscillator may need up to 1 s to stabilize after it is
+     *            started.
+     *
+     * \param[in] seconds The initial time (seconds).
+     */
+    void initialize( std::uint32_t seconds = 0 ) noexcept
+    {
+        *m_timsk = 0;
+
+        m_tc8_async->assr  = Peripheral::TC8_ASYNC::ASSR::Mask::AS;
+        m_tc8_async->tcnt  = 0;
+        m_tc8_async->ocra  = 0;
+        m_tc8_async->tccra = 0;
+        m_tc8_async->tccrb = Peripheral::TC8_ASYNC::TCCRB::CS_CLK_TS_128;
+
+        synchronize();
+
+        m_seconds          = seconds;
+        m_alarm_period     = 0;
+        m_alarm_is_pending = false;
+
+        *m_tifr  = Peripheral::TC8::TIFR::Mask::TOV | Peripheral::TC8::TIFR::Mask::OCFA
+                   | Peripheral::TC8::TIFR::Mask::OCFB;
+        *m_timsk = Peripheral::TC8::TIMSK::Mask::TOIE;
+    }
+
+    /**
+     * \brief Get the current time.
+     *
+     * \attention After waking up from power-save mode, the counter reads as the value it
+     *            had before the CPU went to sleep until the next rising TOSC1 edge.
+     *            picolibrary::Microchip::megaAVR::RTC::Service::synchronize() must be
+     *            called after waking up before the time is read.
+     *
+     * \return The current time.
+     */
+    auto now() const noexcept -> Time
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        return read_time();
+    }
+
+    /**
+     * \brief Set the current time.
+     *
+     * The sub-second tick count is reset. This function blocks until the reset counter
+     * value has been transferred to the asynchronous clock domain, so the time can be
+     * read or set again immediately.
+     *
+     * \param[in] seconds The current time (seconds).
+     */
+    void set( std::uint32_t seconds ) noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        wait_for_update( Peripheral::TC8_ASYNC::ASSR::Mask::TCNUB );
+
+        m_tc8_async->tcnt = 0;
+
+        wait_for_update( Peripheral::TC8_ASYNC::ASSR::Mask::TCNUB );
+
+        *m_tifr = Peripheral::TC8::TIFR::Mask::TOV;
+
+        m_seconds = seconds;
+
+        if ( m_alarm_period ) {
+            schedule_alarm( Time{ seconds, 0 } );
+        } // if
+    }
+
+    /**
+     * \brief Start the periodic alarm.
+     *
+     * The first alarm occurs one period from now, and subsequent alarm deadlines are
+     * advanced by the period from the previous deadline, so the alarm does not drift.
+     *
+     * \param[in] period The alarm period (ticks).
+     *
+     * \pre period > 0
+     */
+    void start_alarm( Ticks period ) noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        m_alarm_period     = period;
+        m_alarm_is_pending = false;
+
+        schedule_alarm( read_time() );
+
+        *m_tifr = Peripheral::TC8::TIFR::Mask::OCFA;
+        *m_timsk |= Peripheral::TC8::TIMSK::Mask::OCIEA;
+    }
+
+    /**
+     * \brief Stop the periodic alarm.
+     */
+    void stop_alarm() noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        *m_timsk &= ~Peripheral::TC8::TIMSK::Mask::OCIEA;
+
+        m_alarm_period     = 0;
+        m_alarm_is_pending = false;
+    }
+
+    /**
+     * \brief Check if an alarm is pending.
+     *
+     * \return true if an alarm is pending.
+     * \return false if an alarm is not pending.
+     */
+    auto alarm_is_pending() const noexcept -> bool
+    {
+        return m_alarm_is_pending;
+    }
+
+    /**
+     * \brief Consume a pending alarm.
+     *
+     * \return true if an alarm was pending.
+     * \return false if an alarm was not pending.
+     */
+    auto consume_alarm() noexcept -> bool
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        auto const alarm_is_pending = m_alarm_is_pending;
+
+        m_alarm_is_pending = false;
+
+        return alarm_is_pending;
+    }
+
+    /**
+     * \brief Synchronize with the asynchronous clock domain.
+     *
+     * A write to TCCRA is performed and the update busy flags are polled until all
+     * pending register updates have been transferred to the asynchronous clock domain.
+     * This must be done before entering power-save mode (otherwise the CPU may wake up
+     * immediately or the pending updates may be lost), and after waking up from
+     * power-save mode before the time is read (so that the counter has been updated
+     * with at least one rising TOSC1 edge).
+     */
+    void synchronize() noexcept
+    {
+        wait_for_update( Peripheral::TC8_ASYNC::ASSR::Mask::TCRAUB );
+
+        m_tc8_async->tccra = 0;
+
+        wait_for_update(
+            Peripheral::TC8_ASYNC::ASSR::Mask::TCRBUB | Peripheral::TC8_ASYNC::ASSR::Mask::TCRAUB
+            | Peripheral::TC8_ASYNC::ASSR::Mask::OCRBUB | Peripheral::TC8_ASYNC::ASSR::Mask::OCRAUB
+            | Peripheral::TC8_ASYNC::ASSR::Mask::TCNUB );
+    }
+
+    /**
+     * \brief Sleep in power-save mode until a condition is true.
+     *
+     * Before the condition is checked, interrupts are disabled and the service is
+     * synchronized with the asynchronous clock domain, so the CPU never enters power-save
+     * mode with register updates pending, and the condition is never checked before the
+     * counter has been updated after waking up.
+     *
+     * \tparam Condition The type of condition to wait for.
+     *
+     * \param[in] cpu The CPU peripheral.
+     * \param[in] condition The condition to wait for (only made true by interrupts).
+     *
+     * \post interrupts are enabled
+     */
+    template<typename Condition>
+    void sleep_until( Peripheral::CPU & cpu, Condition condition ) noexcept
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        for ( ;; ) {
+            interrupt_controller.disable_interrupt();
+
+            synchronize();
+
+            if ( condition() ) {
+                interrupt_controller.enable_interrupt();
+
+                return;
+            } // if
+
+            Power::sleep( cpu, Power::Sleep_Mode::POWER_SAVE );
+        } // for
+    }
+
+    /**
+     * \brief Handle an overflow interrupt.
+     *
+     * \attention This function must be called from the TC8_ASYNC peripheral's overflow
+     *            interrupt service routine (e.g. `TIMER2_OVF_vect`).
+     */
+    void handle_overflow_interrupt() noexcept
+    {
+        m_seconds = m_seconds + 1;
+    }
+
+    /**
+     * \brief Handle an output compare match interrupt.
+     *
+     * \attention This function must be called from the TC8_ASYNC peripheral's output
+     *            compare channel A interrupt service routine (e.g. `TIMER2_COMPA_vect`).
+     */
+    void handle_output_compare_match_interrupt() noexcept
+    {
+        auto const time = read_time();
+
+        if ( time.seconds != m_alarm_seconds ) {
+            return;
+        } // if
+
+        m_alarm_is_pending = true;
+
+        schedule_alarm( Time{ m_alarm_seconds, m_tc8_async->ocra } );
+    }
+
+  private:
+    /**
+     * \brief The TC8_ASYNC peripheral used by the service.
+     */
+    Peripheral::TC8_ASYNC * m_tc8_async{};
+
+    /**
+     * \brief The TC8_ASYNC peripheral's TIMSK register.
+     */
+    Peripheral::TC8::TIMSK * m_timsk{};
+
+    /**
+     * \brief The TC8_ASYNC peripheral's TIFR register.
+     */
+    Peripheral::TC8::TIFR * m_tifr{};
+
+    /**
+     * \brief The number of seconds that have elapsed.
+     */
+    std::uint32_t volatile m_seconds{};
+
+    /**
+     * \brief The alarm period (ticks, 0 if the alarm is stopped).
+     */
+    Ticks m_alarm_period{};
+
+    /**
+     * \brief The seconds portion of the next alarm deadline.
+     */
+    std::uint32_t m_alarm_seconds{};
+
+    /**
+     * \brief The alarm pending flag.
+     */
+    bool volatile m_alarm_is_pending{};
+
+    /**
+     * \brief Disable the service's hardware.
+     */
+    void disable() noexcept
+    {
+        if ( m_tc8_async ) {
+            *m_timsk = 0;
+
+            m_tc8_async->tccrb = 0;
+            m_tc8_async->assr  = 0;
+
+            Power::release( *m_tc8_async );
+        } // if
+    }
+
+    /**
+     * \brief Wait for pending register updates to be transferred to the asynchronous
+     *        clock domain.
+     *
+     * \param[in] mask The mask identifying the update busy flags to poll.
+     */
+    void wait_for_update( std::uint8_t mask ) const noexcept
+    {
+        while ( m_tc8_async->assr & mask ) {} // while
+    }
+
+    /**
+     * \brief Read the current time.
+     *
+     * \attention Interrupts must be disabled when this function is called.
+     *
+     * \return The current time.
+     */
+    auto read_time() const noexcept -> Time
+    {
+        auto time = Time{ m_seconds, m_tc8_async->tcnt };
+
+        if ( *m_tifr & Peripheral::TC8::TIFR::Mask::TOV ) {
+            ++time.seconds;
+            time.ticks = m_tc8_async->tcnt;
+        } // if
+
+        return time;
+    }
+
+    /**
+     * \brief Schedule the next alarm deadline one period after a deadline.
+     *
+     * \attention Interrupts must be disabled when this function is called.
+     *
+     * \param[in] deadline The deadline the next alarm deadline is scheduled relative to.
+     */
+    void schedule_alarm( Time deadline ) noexcept
+    {
+        auto const ticks = m_alarm_period + deadline.ticks;
+
+        m_alarm_seconds = deadline.seconds + ticks / TICKS_PER_SECOND;
+
+        wait_for_update( Peripheral::TC8_ASYNC::ASSR::Mask::OCRAUB );
+
+        m_tc8_async->ocra = ticks % TICKS_PER_SECOND;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::RTC
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_RTC_H
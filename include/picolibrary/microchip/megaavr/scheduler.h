@@ -0,0 +1,436 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Scheduler interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_SCHEDULER_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_SCHEDULER_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+#include "picolibrary/microchip/megaavr/power.h"
+
+/**
+ * \brief Microchip megaAVR cooperative scheduler facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Scheduler {
+
+/**
+ * \brief Scheduler tick count.
+ */
+using Ticks = std::uint16_t;
+
+class Service;
+
+/**
+ * \brief Task.
+ *
+ * A task is periodic if it has a non-zero period, and event triggered otherwise (event
+ * triggered tasks are made ready using
+ * picolibrary::Microchip::megaAVR::Scheduler::Service::trigger()).
+ *
+ * \attention Tasks are linked into a service's task list in place. A task must therefore
+ *            not be destroyed after it has been added to a service.
+ */
+class Task {
+  public:
+    /**
+     * \brief Task function.
+     *
+     * \param[in] context The context that was associated with the task.
+     */
+    using Function = void ( * )( void * context ) noexcept;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Task() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] function The function to execute when the task runs.
+     * \param[in] context The context to pass to the function.
+     * \param[in] priority The task's priority (0 is the highest priority).
+     * \param[in] period The task's period (0 if the task is event triggered).
+     * \param[in] deadline The maximum number of ticks between the task being made ready
+     *            and the task completing (0 if the task's deadline is its period or, for
+     *            event triggered tasks, if the task has no deadline).
+     */
+    constexpr Task(
+        Function     function,
+        void *       context,
+        std::uint8_t priority,
+        Ticks        period   = 0,
+        Ticks        deadline = 0 ) noexcept :
+        m_function{ function },
+        m_context{ context },
+        m_priority{ priority },
+        m_period{ period },
+        m_deadline{ deadline ? deadline : period }
+    {
+    }
+
+    Task( Task && ) = delete;
+
+    Task( Task const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Task() noexcept = default;
+
+    auto operator=( Task && ) = delete;
+
+    auto operator=( Task const & ) = delete;
+
+    /**
+     * \brief Check if the task is ready.
+     *
+     * \return true if the task is ready.
+     * \return false if the task is not ready.
+     */
+    auto is_ready() const noexcept -> bool
+    {
+        return m_is_ready;
+    }
+
+    /**
+     * \brief Get the number of deadlines the task has missed (saturates at 255).
+     *
+     * A deadline is missed if the task completes more than its deadline ticks after it
+     * was made ready, or if a periodic task is released again before it has run.
+     *
+     * \return The number of deadlines the task has missed.
+     */
+    auto missed_deadlines() const noexcept -> std::uint_fast8_t
+    {
+        return m_missed_deadlines;
+    }
+
+    /**
+     * \brief Clear the missed deadline count.
+     */
+    void clear_missed_deadlines() noexcept
+    {
+        m_missed_deadlines = 0;
+    }
+
+  private:
+    friend class Service;
+
+    /**
+     * \brief The next task in the service's task list.
+     */
+    Task * m_next{};
+
+    /**
+     * \brief The function to execute when the task runs.
+     */
+    Function m_function{};
+
+    /**
+     * \brief The context to pass to the function.
+     */
+    void * m_context{};
+
+    /**
+     * \brief The task's priority.
+     */
+    std::uint8_t m_priority{};
+
+    /**
+     * \brief The task's period.
+     */
+    Ticks m_period{};
+
+    /**
+     * \brief The task's deadline.
+     */
+    Ticks m_deadline{};
+
+    /**
+     * \brief The tick the task will next be released at (periodic tasks only).
+     */
+    Ticks m_next_release{};
+
+    /**
+     * \brief The tick the task was made ready at.
+     */
+    Ticks m_release{};
+
+    /**
+     * \brief The task's ready flag.
+     */
+    bool volatile m_is_ready{};
+
+    /**
+     * \brief The number of deadlines the task has missed.
+     */
+    std::uint8_t m_missed_deadlines{};
+
+    /**
+     * \brief Record a missed deadline.
+     */
+    void miss_deadline() noexcept
+    {
+        if ( m_missed_deadlines != 0xFF ) {
+            ++m_missed_deadlines;
+        } // if
+    }
+};
+
+/**
+ * \brief Run to completion cooperative scheduler service.
+ *
+ * The service's tick handler must be called periodically from an interrupt service
+ * routine (e.g. from a TC8 peripheral's output compare match interrupt service routine,
+ * or from a software timer using interrupt dispatch). Periodic task periods and task
+ * deadlines are measured in these ticks.
+ *
+ * When no task is ready, the service puts the CPU to sleep until an interrupt occurs.
+ */
+class Service {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Service() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] cpu The CPU peripheral.
+     * \param[in] sleep_mode The sleep mode to use while no task is ready (the tick
+     *            interrupt source must be able to wake the CPU from this sleep mode).
+     */
+    constexpr Service( Peripheral::CPU & cpu, Power::Sleep_Mode sleep_mode = Power::Sleep_Mode::IDLE ) noexcept :
+        m_cpu{ &cpu },
+        m_sleep_mode{ sleep_mode }
+    {
+    }
+
+    Service( Service && ) = delete;
+
+    Service( Service const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Service() noexcept = default;
+
+    auto operator=( Service && ) = delete;
+
+    auto operator=( Service const & ) = delete;
+
+    /**
+     * \brief Add a task to the service.
+     *
+     * Periodic tasks are first released when they are added.
+     *
+     * \attention This function must be called from the main context.
+     *
+     * \param[in] task The task to add.
+     */
+    void add( Task & task ) noexcept
+    {
+        task.m_next_release = now();
+
+        auto link = &m_tasks;
+        while ( *link and ( *link )->m_priority <= task.m_priority ) {
+            link = &( *link )->m_next;
+        } // while
+
+        task.m_next = *link;
+        *link       = &task;
+    }
+
+    /**
+     * \brief Make an event triggered task ready.
+     *
+     * Triggering a task that is already ready has no effect.
+     *
+     * \param[in] task The task to make ready.
+     */
+    void trigger( Task & task ) noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        if ( not task.m_is_ready ) {
+            task.m_release  = m_now;
+            task.m_is_ready = true;
+        } // if
+
+        m_is_pending = true;
+    }
+
+    /**
+     * \brief Get the current tick count.
+     *
+     * \return The current tick count.
+     */
+    auto now() const noexcept -> Ticks
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        return m_now;
+    }
+
+    /**
+     * \brief Handle a tick.
+     *
+     * \attention This function must be called from an interrupt service routine.
+     */
+    void handle_tick() noexcept
+    {
+        m_now        = m_now + 1;
+        m_is_pending = true;
+    }
+
+    /**
+     * \brief Run the highest priority ready task.
+     *
+     * \attention This function must be called from the main context.
+     *
+     * \return true if a task was run.
+     * \return false if no task was ready.
+     */
+    auto run_once() noexcept -> bool
+    {
+        m_is_pending = false;
+
+        release( now() );
+
+        for ( auto task = m_tasks; task; task = task->m_next ) {
+            if ( task->m_is_ready ) {
+                execute( *task );
+
+                return true;
+            } // if
+        } // for
+
+        return false;
+    }
+
+    /**
+     * \brief Run tasks, sleeping while no task is ready.
+     *
+     * \pre interrupts are enabled
+     */
+    [[noreturn]] void run() noexcept
+    {
+        for ( ;; ) {
+            if ( not run_once() ) {
+                idle();
+            } // if
+        } // for
+    }
+
+  private:
+    /**
+     * \brief The CPU peripheral.
+     */
+    Peripheral::CPU * m_cpu{};
+
+    /**
+     * \brief The sleep mode to use while no task is ready.
+     */
+    Power::Sleep_Mode m_sleep_mode{};
+
+    /**
+     * \brief The task list (sorted by priority).
+     */
+    Task * m_tasks{};
+
+    /**
+     * \brief The current tick count.
+     */
+    Ticks volatile m_now{};
+
+    /**
+     * \brief The pending event flag (set by ticks and triggers since the task list was
+     *        last checked).
+     */
+    bool volatile m_is_pending{};
+
+    /**
+     * \brief Release periodic tasks that are due.
+     *
+     * Each release is made in a critical section since tasks may be triggered from
+     * interrupt service routines.
+     *
+     * \param[in] now The current tick count.
+     */
+    void release( Ticks now ) noexcept
+    {
+        for ( auto task = m_tasks; task; task = task->m_next ) {
+            if ( task->m_period
+                 and static_cast<std::int16_t>( now - task->m_next_release ) >= 0 ) {
+                auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+                if ( task->m_is_ready ) {
+                    task->miss_deadline();
+                } // if
+
+                task->m_release = task->m_next_release;
+                task->m_next_release += task->m_period;
+                task->m_is_ready = true;
+            } // if
+        } // for
+    }
+
+    /**
+     * \brief Execute a ready task.
+     *
+     * \param[in] task The task to execute.
+     */
+    void execute( Task & task ) noexcept
+    {
+        auto release = Ticks{};
+
+        {
+            auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+            release         = task.m_release;
+            task.m_is_ready = false;
+        }
+
+        task.m_function( task.m_context );
+
+        if ( task.m_deadline and static_cast<Ticks>( now() - release ) > task.m_deadline ) {
+            task.miss_deadline();
+        } // if
+    }
+
+    /**
+     * \brief Sleep until a tick or trigger occurs (returns immediately if a tick or
+     *        trigger has occurred since the task list was last checked).
+     */
+    void idle() noexcept
+    {
+        Power::sleep_until( *m_cpu, m_sleep_mode, [this]() noexcept { return m_is_pending; } );
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Scheduler
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_SCHEDULER_H
@@ -0,0 +1,893 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Software_Timer interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_SOFTWARE_TIMER_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_SOFTWARE_TIMER_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/tc16.h"
+#include "picolibrary/microchip/megaavr/power.h"
+#include "picolibrary/register.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Microchip megaAVR software timer facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Software_Timer {
+
+/**
+ * \brief TC16 clock source.
+ */
+enum class TC16_Clock_Source : std::uint8_t {
+    CLK_IO_1    = Peripheral::TC16::TCCRB::CS_CLK_IO_1,    ///< clk_I/O / 1.
+    CLK_IO_8    = Peripheral::TC16::TCCRB::CS_CLK_IO_8,    ///< clk_I/O / 8.
+    CLK_IO_64   = Peripheral::TC16::TCCRB::CS_CLK_IO_64,   ///< clk_I/O / 64.
+    CLK_IO_256  = Peripheral::TC16::TCCRB::CS_CLK_IO_256,  ///< clk_I/O / 256.
+    CLK_IO_1024 = Peripheral::TC16::TCCRB::CS_CLK_IO_1024, ///< clk_I/O / 1024.
+};
+
+/**
+ * \brief TC16 output compare channel.
+ */
+enum class TC16_Output_Compare_Channel : std::uint8_t {
+    A, ///< A.
+    B, ///< B.
+};
+
+/**
+ * \brief Software timer tick count (TC16 counter clock periods).
+ */
+using Ticks = std::uint32_t;
+
+class Service;
+
+/**
+ * \brief Software timer.
+ *
+ * \attention Timers are linked into a service's timer set in place. A timer must
+ *            therefore not be destroyed while it is running or while it has an
+ *            expiration that is waiting to be dispatched.
+ */
+class Timer {
+  public:
+    /**
+     * \brief Expiration callback.
+     *
+     * \param[in] context The context that was associated with the timer.
+     */
+    using Callback = void ( * )( void * context ) noexcept;
+
+    /**
+     * \brief Expiration callback dispatch method.
+     */
+    enum class Dispatch : std::uint8_t {
+        INTERRUPT, ///< The callback is executed in interrupt context when the timer expires.
+        DEFERRED, ///< The callback is executed by picolibrary::Microchip::megaAVR::Software_Timer::Service::dispatch().
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Timer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] callback The callback to execute when the timer expires.
+     * \param[in] context The context to pass to the callback.
+     * \param[in] dispatch The callback dispatch method.
+     */
+    constexpr Timer( Callback callback, void * context, Dispatch dispatch ) noexcept :
+        m_callback{ callback },
+        m_context{ context },
+        m_dispatch{ dispatch }
+    {
+    }
+
+    Timer( Timer && ) = delete;
+
+    Timer( Timer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Timer() noexcept = default;
+
+    auto operator=( Timer && ) = delete;
+
+    auto operator=( Timer const & ) = delete;
+
+    /**
+     * \brief Check if the timer is running.
+     *
+     * \return true if the timer is running.
+     * \return false if the timer is not running.
+     */
+    auto is_running() const noexcept -> bool
+    {
+        bool const volatile & running = m_is_running;
+
+        return running;
+    }
+
+  private:
+    friend class Service;
+
+    /**
+     * \brief The next timer in the timer's timer set slot (or in the service's expired
+     *        timer list).
+     */
+    Timer * m_next{};
+
+    /**
+     * \brief The previous timer in the timer's timer set slot.
+     */
+    Timer * m_previous{};
+
+    /**
+     * \brief The next timer in the deferred dispatch queue.
+     */
+    Timer * m_queue_next{};
+
+    /**
+     * \brief The timer's deadline.
+     */
+    Ticks m_deadline{};
+
+    /**
+     * \brief The timer's period (0 if the timer is a one-shot timer).
+     */
+    Ticks m_period{};
+
+    /**
+     * \brief The callback to execute when the timer expires.
+     */
+    Callback m_callback{};
+
+    /**
+     * \brief The context to pass to the callback.
+     */
+    void * m_context{};
+
+    /**
+     * \brief The callback dispatch method.
+     */
+    Dispatch m_dispatch{};
+
+    /**
+     * \brief The timer's running state.
+     */
+    bool m_is_running{};
+
+    /**
+     * \brief The timer's expired timer list membership state (the timer has expired but
+     *        its expiration has not been handled yet).
+     */
+    bool m_is_expired{};
+
+    /**
+     * \brief The timer's deferred dispatch queue membership state.
+     */
+    bool m_is_queued{};
+
+    /**
+     * \brief The timer's deferred dispatch pending state.
+     */
+    bool m_dispatch_is_pending{};
+};
+
+/**
+ * \brief Tickless software timer service.
+ *
+ * The service runs a TC16 peripheral's counter freely in normal mode and uses a single
+ * output compare channel to generate an interrupt at the next timer deadline. Running
+ * timers are kept in a hashed timing wheel (timers are hashed into slots by deadline
+ * window) which provides O(1) timer start and stop. When no timer is running, the output
+ * compare interrupt is disabled and the service generates no interrupts.
+ *
+ * The service's output compare match interrupt handler must be called from the
+ * interrupt service routine for the TC16 peripheral output compare channel used by the
+ * service (e.g. `ISR( TIMER1_COMPA_vect ) { service.handle_output_compare_match_interrupt();
+ * }`).
+ */
+class Service {
+  public:
+    /**
+     * \brief The number of slots in the timer set.
+     */
+    static constexpr auto SLOTS = std::uint_fast8_t{ 8 };
+
+    /**
+     * \brief The base 2 logarithm of the timer set slot width (ticks).
+     */
+    static constexpr auto SLOT_WIDTH_EXPONENT = std::uint_fast8_t{ 12 };
+
+    /**
+     * \brief The maximum number of ticks between output compare match interrupts while
+     *        one or more timers are running.
+     */
+    static constexpr auto HORIZON = Ticks{ Ticks{ SLOTS } << SLOT_WIDTH_EXPONENT };
+
+    static_assert( HORIZON <= 0x8000 );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Service() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] tc16 The TC16 peripheral to be used by the service.
+     * \param[in] timsk The TC16 peripheral's TIMSK register.
+     * \param[in] tifr The TC16 peripheral's TIFR register.
+     * \param[in] tc16_clock_source The desired TC16 clock source.
+     * \param[in] tc16_output_compare_channel The TC16 output compare channel to be used
+     *            by the service.
+     */
+    Service(
+        Peripheral::TC16 &          tc16,
+        Peripheral::TC16::TIMSK &   timsk,
+        Peripheral::TC16::TIFR &    tifr,
+        TC16_Clock_Source           tc16_clock_source,
+        TC16_Output_Compare_Channel tc16_output_compare_channel ) noexcept :
+        m_tc16{ &tc16 },
+        m_timsk{ &timsk },
+        m_tifr{ &tifr },
+        m_ocr{ tc16_output_compare_channel == TC16_Output_Compare_Channel::A ? &tc16.ocra : &tc16.ocrb },
+        m_ocie{ tc16_output_compare_channel == TC16_Output_Compare_Channel::A
+                    ? Peripheral::TC16::TIMSK::Mask::OCIEA
+                    : Peripheral::TC16::TIMSK::Mask::OCIEB },
+        m_ocf{ tc16_output_compare_channel == TC16_Output_Compare_Channel::A
+                   ? Peripheral::TC16::TIFR::Mask::OCFA
+                   : Peripheral::TC16::TIFR::Mask::OCFB },
+        m_tc16_clock_source{ tc16_clock_source }
+    {
+        Power::acquire( tc16 );
+    }
+
+    Service( Service && ) = delete;
+
+    Service( Service const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Service() noexcept
+    {
+        disable();
+    }
+
+    auto operator=( Service && ) = delete;
+
+    auto operator=( Service const & ) = delete;
+
+    /**
+     * \brief Initialize the service's hardware.
+     */
+    void initialize() noexcept
+    {
+        m_tc16->tccra = 0;
+        m_tc16->tccrb = to_underlying( m_tc16_clock_source );
+
+        m_tcnt = m_tc16->tcnt;
+    }
+
+    /**
+     * \brief Start a timer.
+     *
+     * \attention If the timer is already running, it is restarted.
+     *
+     * \attention If the timer's delay has already elapsed by the time the timer has been
+     *            added to the timer set, the timer's expiration is handled before this
+     *            function returns (callbacks that are dispatched in interrupt context are
+     *            executed with interrupts disabled).
+     *
+     * \param[in] timer The timer to start.
+     * \param[in] delay The number of ticks until the timer expires (must be less than
+     *            2^31).
+     * \param[in] period The number of ticks between subsequent timer expirations (0 if
+     *            the timer is a one-shot timer, must be less than 2^31).
+     */
+    void start( Timer & timer, Ticks delay, Ticks period = 0 ) noexcept
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+        interrupt_controller.disable_interrupt();
+
+        if ( timer.m_is_running ) {
+            remove( timer );
+        } else if ( timer.m_is_expired ) {
+            discard_expiration( timer );
+        } // else if
+
+        update_time();
+
+        timer.m_deadline = m_now + delay;
+        timer.m_period   = period;
+
+        insert( timer );
+
+        if ( not m_is_armed or is_before( timer.m_deadline, m_next_wake ) ) {
+            if ( not arm( timer.m_deadline ) ) {
+                service();
+            } // if
+        }     // if
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+    }
+
+    /**
+     * \brief Stop a timer.
+     *
+     * \attention Stopping a timer also cancels any pending deferred dispatch of its
+     *            callback.
+     *
+     * \param[in] timer The timer to stop.
+     */
+    void stop( Timer & timer ) noexcept
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+        interrupt_controller.disable_interrupt();
+
+        if ( timer.m_is_running ) {
+            remove( timer );
+        } else if ( timer.m_is_expired ) {
+            discard_expiration( timer );
+        } // else if
+
+        timer.m_dispatch_is_pending = false;
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+    }
+
+    /**
+     * \brief Execute the callbacks of expired timers that use deferred dispatch.
+     *
+     * \attention This function should be called from the main loop.
+     */
+    void dispatch() noexcept
+    {
+        for ( auto timer = dequeue(); timer; timer = dequeue() ) {
+            timer->m_callback( timer->m_context );
+        } // for
+    }
+
+    /**
+     * \brief Handle an output compare match interrupt.
+     *
+     * \attention This function must be called from the interrupt service routine for the
+     *            TC16 peripheral output compare channel used by the service.
+     */
+    void handle_output_compare_match_interrupt() noexcept
+    {
+        service();
+    }
+
+  private:
+    /**
+     * \brief The mask used to wrap timer set window indices.
+     */
+    static constexpr auto WINDOW_MASK = Ticks{ ~Ticks{} >> SLOT_WIDTH_EXPONENT };
+
+    /**
+     * \brief The TC16 peripheral used by the service.
+     */
+    Peripheral::TC16 * m_tc16{};
+
+    /**
+     * \brief The TC16 peripheral's TIMSK register.
+     */
+    Peripheral::TC16::TIMSK * m_timsk{};
+
+    /**
+     * \brief The TC16 peripheral's TIFR register.
+     */
+    Peripheral::TC16::TIFR * m_tifr{};
+
+    /**
+     * \brief The TC16 output compare register used by the service.
+     */
+    Register<std::uint16_t> * m_ocr{};
+
+    /**
+     * \brief The TIMSK register output compare match interrupt enable mask.
+     */
+    std::uint8_t m_ocie{};
+
+    /**
+     * \brief The TIFR register output compare match flag mask.
+     */
+    std::uint8_t m_ocf{};
+
+    /**
+     * \brief The TC16 clock source.
+     */
+    TC16_Clock_Source m_tc16_clock_source{};
+
+    /**
+     * \brief The timer set slots.
+     */
+    Timer * m_slots[ SLOTS ]{};
+
+    /**
+     * \brief The timer set slot occupancy map.
+     */
+    std::uint8_t m_occupied_slots{};
+
+    /**
+     * \brief The current time.
+     */
+    Ticks m_now{};
+
+    /**
+     * \brief The TC16 counter value at the last time update.
+     */
+    std::uint16_t m_tcnt{};
+
+    /**
+     * \brief The most recently processed timer set window.
+     */
+    Ticks m_cursor{};
+
+    /**
+     * \brief The time of the next output compare match interrupt.
+     */
+    Ticks m_next_wake{};
+
+    /**
+     * \brief The output compare match interrupt armed state.
+     */
+    bool m_is_armed{};
+
+    /**
+     * \brief The expired timers whose expirations have not been handled yet.
+     */
+    Timer * m_expired_timers{};
+
+    /**
+     * \brief The head of the deferred dispatch queue.
+     */
+    Timer * m_queue_head{};
+
+    /**
+     * \brief The tail of the deferred dispatch queue.
+     */
+    Timer * m_queue_tail{};
+
+    /**
+     * \brief Check if a time is before another time.
+     *
+     * \param[in] a The time to check.
+     * \param[in] b The time to check against.
+     *
+     * \return true if a is before b.
+     * \return false if a is not before b.
+     */
+    static constexpr auto is_before( Ticks a, Ticks b ) noexcept -> bool
+    {
+        return static_cast<std::int32_t>( a - b ) < 0;
+    }
+
+    /**
+     * \brief Get the timer set window that contains a time.
+     *
+     * \param[in] time The time whose window is to be gotten.
+     *
+     * \return The timer set window that contains the time.
+     */
+    static constexpr auto window( Ticks time ) noexcept -> Ticks
+    {
+        return time >> SLOT_WIDTH_EXPONENT;
+    }
+
+    /**
+     * \brief Get the timer set slot associated with a window.
+     *
+     * \param[in] window The window whose slot is to be gotten.
+     *
+     * \return The timer set slot associated with the window.
+     */
+    static constexpr auto slot( Ticks window ) noexcept -> std::uint_fast8_t
+    {
+        return window & ( SLOTS - 1 );
+    }
+
+    /**
+     * \brief Disable the service.
+     */
+    void disable() noexcept
+    {
+        if ( m_tc16 ) {
+            *m_timsk &= ~m_ocie;
+            m_tc16->tccrb = 0;
+
+            Power::release( *m_tc16 );
+        } // if
+    }
+
+    /**
+     * \brief Update the current time.
+     */
+    void update_time() noexcept
+    {
+        std::uint16_t const tcnt = m_tc16->tcnt;
+
+        m_now += static_cast<std::uint16_t>( tcnt - m_tcnt );
+        m_tcnt = tcnt;
+    }
+
+    /**
+     * \brief Add a timer to the timer set.
+     *
+     * \param[in] timer The timer to add to the timer set.
+     */
+    void insert( Timer & timer ) noexcept
+    {
+        auto const timer_slot = slot( window( timer.m_deadline ) );
+
+        timer.m_previous = nullptr;
+        timer.m_next     = m_slots[ timer_slot ];
+
+        if ( timer.m_next ) {
+            timer.m_next->m_previous = &timer;
+        } // if
+
+        m_slots[ timer_slot ] = &timer;
+        m_occupied_slots |= 1 << timer_slot;
+
+        timer.m_is_running = true;
+    }
+
+    /**
+     * \brief Remove a timer from the timer set.
+     *
+     * \param[in] timer The timer to remove from the timer set.
+     */
+    void remove( Timer & timer ) noexcept
+    {
+        auto const timer_slot = slot( window( timer.m_deadline ) );
+
+        if ( timer.m_previous ) {
+            timer.m_previous->m_next = timer.m_next;
+        } else {
+            m_slots[ timer_slot ] = timer.m_next;
+        } // else
+
+        if ( timer.m_next ) {
+            timer.m_next->m_previous = timer.m_previous;
+        } // if
+
+        if ( not m_slots[ timer_slot ] ) {
+            m_occupied_slots &= ~( 1 << timer_slot );
+        } // if
+
+        timer.m_is_running = false;
+    }
+
+    /**
+     * \brief Handle the expiration of expired timers and arm the output compare match
+     *        interrupt for the next deadline.
+     *
+     * The expired timer list is a member (instead of a local list) and each timer is
+     * detached from it before its expiration is handled, so a callback that is executed
+     * in interrupt context can start or stop any timer (including one that is still in
+     * the expired timer list) without corrupting the list or the timer set.
+     */
+    void service() noexcept
+    {
+        do {
+            update_time();
+
+            m_expired_timers = collect_expired_timers();
+
+            while ( m_expired_timers ) {
+                auto & timer = *m_expired_timers;
+
+                m_expired_timers   = timer.m_next;
+                timer.m_next       = nullptr;
+                timer.m_is_expired = false;
+
+                expire( timer );
+            } // while
+        } while ( not arm_next_wake() );
+    }
+
+    /**
+     * \brief Remove the expired timers from the timer set and add them to the expired
+     *        timer list.
+     *
+     * \return The updated expired timer list.
+     */
+    auto collect_expired_timers() noexcept -> Timer *
+    {
+        auto const current_window = window( m_now );
+        auto       windows        = ( ( current_window - m_cursor ) & WINDOW_MASK ) + 1;
+
+        if ( windows > SLOTS ) {
+            windows = SLOTS;
+        } // if
+
+        m_cursor = current_window;
+
+        auto expired_timers = m_expired_timers;
+        for ( auto w = current_window - ( windows - 1 ); windows; --windows, ++w ) {
+            expired_timers = collect_expired_timers( slot( w ), expired_timers );
+        } // for
+
+        return expired_timers;
+    }
+
+    /**
+     * \brief Remove the expired timers in a timer set slot from the timer set.
+     *
+     * \param[in] timer_slot The timer set slot to check for expired timers.
+     * \param[in] expired_timers The list of expired timers.
+     *
+     * \return The updated list of expired timers.
+     */
+    auto collect_expired_timers( std::uint_fast8_t timer_slot, Timer * expired_timers ) noexcept
+        -> Timer *
+    {
+        for ( auto timer = m_slots[ timer_slot ]; timer; ) {
+            auto & candidate = *timer;
+
+            timer = timer->m_next;
+
+            if ( not is_before( m_now, candidate.m_deadline ) ) {
+                remove( candidate );
+
+                candidate.m_next       = expired_timers;
+                candidate.m_is_expired = true;
+                expired_timers         = &candidate;
+            } // if
+        }     // for
+
+        return expired_timers;
+    }
+
+    /**
+     * \brief Remove a timer from the expired timer list (discarding its expiration).
+     *
+     * \param[in] timer The timer to remove from the expired timer list.
+     */
+    void discard_expiration( Timer & timer ) noexcept
+    {
+        auto link = &m_expired_timers;
+        while ( *link != &timer ) { link = &( *link )->m_next; } // while
+
+        *link = timer.m_next;
+
+        timer.m_next       = nullptr;
+        timer.m_is_expired = false;
+    }
+
+    /**
+     * \brief Handle a timer's expiration.
+     *
+     * \param[in] timer The expired timer.
+     */
+    void expire( Timer & timer ) noexcept
+    {
+        if ( timer.m_period ) {
+            timer.m_deadline += timer.m_period;
+
+            insert( timer );
+        } // if
+
+        if ( timer.m_dispatch == Timer::Dispatch::INTERRUPT ) {
+            timer.m_callback( timer.m_context );
+
+            return;
+        } // if
+
+        enqueue( timer );
+    }
+
+    /**
+     * \brief Add a timer to the deferred dispatch queue.
+     *
+     * \param[in] timer The timer to add to the deferred dispatch queue.
+     */
+    void enqueue( Timer & timer ) noexcept
+    {
+        timer.m_dispatch_is_pending = true;
+
+        if ( timer.m_is_queued ) {
+            return;
+        } // if
+
+        timer.m_is_queued  = true;
+        timer.m_queue_next = nullptr;
+
+        if ( m_queue_tail ) {
+            m_queue_tail->m_queue_next = &timer;
+        } else {
+            m_queue_head = &timer;
+        } // else
+
+        m_queue_tail = &timer;
+    }
+
+    /**
+     * \brief Remove the next timer with a pending deferred dispatch from the deferred
+     *        dispatch queue.
+     *
+     * \return The next timer with a pending deferred dispatch if the deferred dispatch
+     *         queue contains a timer with a pending deferred dispatch.
+     * \return nullptr if the deferred dispatch queue does not contain a timer with a
+     *         pending deferred dispatch.
+     */
+    auto dequeue() noexcept -> Timer *
+    {
+        auto interrupt_controller = Interrupt::Controller{};
+
+        auto const interrupt_enable_state = interrupt_controller.save_interrupt_enable_state();
+        interrupt_controller.disable_interrupt();
+
+        auto timer = m_queue_head;
+        while ( timer and not pop( *timer ) ) {
+            timer = m_queue_head;
+        } // while
+
+        interrupt_controller.restore_interrupt_enable_state( interrupt_enable_state );
+
+        return timer;
+    }
+
+    /**
+     * \brief Remove the timer at the head of the deferred dispatch queue from the
+     *        deferred dispatch queue.
+     *
+     * \param[in] timer The timer at the head of the deferred dispatch queue.
+     *
+     * \return true if the timer's deferred dispatch is pending.
+     * \return false if the timer's deferred dispatch is not pending.
+     */
+    auto pop( Timer & timer ) noexcept -> bool
+    {
+        m_queue_head = timer.m_queue_next;
+
+        if ( not m_queue_head ) {
+            m_queue_tail = nullptr;
+        } // if
+
+        timer.m_is_queued = false;
+
+        auto const dispatch_is_pending = timer.m_dispatch_is_pending;
+
+        timer.m_dispatch_is_pending = false;
+
+        return dispatch_is_pending;
+    }
+
+    /**
+     * \brief Arm the output compare match interrupt for the next deadline.
+     *
+     * \return true if the output compare match interrupt was armed, or disarmed because
+     *         no timers are running.
+     * \return false if the next deadline has already passed.
+     */
+    auto arm_next_wake() noexcept -> bool
+    {
+        if ( not m_occupied_slots ) {
+            *m_timsk &= ~m_ocie;
+            m_is_armed = false;
+
+            return true;
+        } // if
+
+        return arm( next_wake() );
+    }
+
+    /**
+     * \brief Get the time of the next output compare match interrupt.
+     *
+     * \return The earliest deadline within the next revolution of the timer set if the
+     *         timer set contains a timer whose deadline is within the next revolution.
+     * \return The start of the next revolution of the timer set if the timer set does
+     *         not contain a timer whose deadline is within the next revolution.
+     */
+    auto next_wake() const noexcept -> Ticks
+    {
+        auto const current_window = window( m_now );
+
+        for ( auto i = std::uint_fast8_t{}; i < SLOTS; ++i ) {
+            auto const w = ( current_window + i ) & WINDOW_MASK;
+
+            auto deadline = Ticks{};
+            if ( earliest_deadline( w, deadline ) ) {
+                return deadline;
+            } // if
+        }     // for
+
+        return ( current_window + SLOTS ) << SLOT_WIDTH_EXPONENT;
+    }
+
+    /**
+     * \brief Get the earliest deadline within a timer set window.
+     *
+     * \param[in] w The timer set window to search.
+     * \param[out] deadline The earliest deadline within the window.
+     *
+     * \return true if the window contains a deadline.
+     * \return false if the window does not contain a deadline.
+     */
+    auto earliest_deadline( Ticks w, Ticks & deadline ) const noexcept -> bool
+    {
+        auto found = false;
+
+        if ( not( m_occupied_slots & ( 1 << slot( w ) ) ) ) {
+            return found;
+        } // if
+
+        for ( auto timer = m_slots[ slot( w ) ]; timer; timer = timer->m_next ) {
+            if ( window( timer->m_deadline ) == w
+                 and ( not found or is_before( timer->m_deadline, deadline ) ) ) {
+                deadline = timer->m_deadline;
+                found    = true;
+            } // if
+        }     // for
+
+        return found;
+    }
+
+    /**
+     * \brief Arm the output compare match interrupt.
+     *
+     * \param[in] target The desired output compare match interrupt time.
+     *
+     * \return true if the output compare match interrupt was armed.
+     * \return false if the desired output compare match interrupt time has already
+     *         passed.
+     */
+    auto arm( Ticks target ) noexcept -> bool
+    {
+        if ( not is_before( m_now, target ) ) {
+            return false;
+        } // if
+
+        if ( is_before( m_now + HORIZON, target ) ) {
+            target = m_now + HORIZON;
+        } // if
+
+        auto const delay = static_cast<std::uint16_t>( target - m_now );
+
+        m_next_wake = target;
+        m_is_armed  = true;
+
+        *m_ocr   = static_cast<std::uint16_t>( m_tcnt + delay );
+        *m_tifr  = m_ocf;
+        *m_timsk |= m_ocie;
+
+        return static_cast<std::uint16_t>( m_tc16->tcnt - m_tcnt ) < delay;
+    }
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Software_Timer
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_SOFTWARE_TIMER_H
@@ -23,13 +23,18 @@
 #ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_SPI_H
 #define PICOLIBRARY_MICROCHIP_MEGAAVR_SPI_H
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
+#include "picolibrary/microchip/megaavr/clock.h"
 #include "picolibrary/microchip/megaavr/gpio.h"
+#include "picolibrary/microchip/megaavr/interrupt.h"
 #include "picolibrary/microchip/megaavr/multiplexed_signals.h"
 #include "picolibrary/microchip/megaavr/peripheral/spi.h"
 #include "picolibrary/microchip/megaavr/peripheral/usart.h"
+#include "picolibrary/microchip/megaavr/power.h"
+#include "picolibrary/rom.h"
 #include "picolibrary/spi.h"
 #include "picolibrary/utility.h"
 
@@ -168,6 +173,8 @@ class Fixed_Configuration_Basic_Controller<Peripheral::SPI> {
                         static_cast<std::uint8_t>(
                             Multiplexed_Signals::sck_mask( spi ) | Multiplexed_Signals::mosi_mask( spi ) ) }
     {
+        Power::acquire( spi );
+
         configure_controller( spi_clock_rate, spi_clock_polarity, spi_clock_phase, spi_bit_order );
     }
 
@@ -178,6 +185,8 @@ class Fixed_Configuration_Basic_Controller<Peripheral::SPI> {
      */
     constexpr Fixed_Configuration_Basic_Controller( Fixed_Configuration_Basic_Controller && source ) noexcept :
         m_spi{ source.m_spi },
+        m_spcr{ source.m_spcr },
+        m_spsr{ source.m_spsr },
         m_spi_sck_mosi{ std::move( source.m_spi_sck_mosi ) }
     {
         source.m_spi = nullptr;
@@ -207,6 +216,8 @@ class Fixed_Configuration_Basic_Controller<Peripheral::SPI> {
             disable();
 
             m_spi          = expression.m_spi;
+            m_spcr         = expression.m_spcr;
+            m_spsr         = expression.m_spsr;
             m_spi_sck_mosi = std::move( expression.m_spi_sck_mosi );
 
             expression.m_spi = nullptr;
@@ -255,12 +266,75 @@ class Fixed_Configuration_Basic_Controller<Peripheral::SPI> {
         return finish_exchange();
     }
 
+    /**
+     * \brief Transmit a block of data stored in ROM to a device.
+     *
+     * Each byte is read from ROM while the previous byte is being transmitted, and the
+     * data received from the device is ignored.
+     *
+     * \param[in] begin The beginning of the block of data stored in ROM to transmit.
+     * \param[in] end The end of the block of data stored in ROM to transmit.
+     */
+    void transmit( ROM::String begin, ROM::String end ) noexcept
+    {
+        if ( begin == end ) {
+            return;
+        } // if
+
+        auto reader = ROM::Reader{ begin };
+
+        initiate_exchange( reader.read() );
+
+        for ( auto n = static_cast<std::size_t>( end - begin ) - 1; n; --n ) {
+            auto const data = reader.read();
+
+            while ( not exchange_complete() ) {} // while
+
+            initiate_exchange( data );
+        } // for
+
+        while ( not exchange_complete() ) {} // while
+
+        static_cast<void>( finish_exchange() );
+    }
+
+    /**
+     * \brief Handle a system clock prescaler change.
+     *
+     * \param[in] previous_shift The previous clock shift.
+     * \param[in] shift The new clock shift.
+     */
+    void handle_clock_change( std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept
+    {
+        static_cast<void>( previous_shift );
+
+        std::uint8_t spcr = m_spcr;
+        std::uint8_t spsr = m_spsr;
+
+        Clock::scale_spi_clock_rate( spcr, spsr, shift );
+
+        m_spi->spcr = spcr | ( m_spi->spcr & Peripheral::SPI::SPCR::Mask::SPE );
+        m_spi->spsr = spsr;
+    }
+
   private:
     /**
      * \brief The SPI used by the controller.
      */
     Peripheral::SPI * m_spi{};
 
+    /**
+     * \brief The SPCR register value the controller was configured with (unscaled
+     *        system clock, SPI disabled).
+     */
+    std::uint8_t m_spcr{};
+
+    /**
+     * \brief The SPSR register value the controller was configured with (unscaled
+     *        system clock).
+     */
+    std::uint8_t m_spsr{};
+
     /**
      * \brief The SPI's SCK and MOSI pins.
      */
@@ -273,6 +347,8 @@ class Fixed_Configuration_Basic_Controller<Peripheral::SPI> {
     {
         if ( m_spi ) {
             disable_controller();
+
+            Power::release( *m_spi );
         } // if
     }
 
@@ -290,11 +366,14 @@ class Fixed_Configuration_Basic_Controller<Peripheral::SPI> {
         SPI_Clock_Phase    spi_clock_phase,
         SPI_Bit_Order      spi_bit_order ) noexcept
     {
-        m_spi->spcr = Peripheral::SPI::SPCR::Mask::MSTR
-                      | ( to_underlying( spi_clock_rate ) >> SPI_CLOCK_RATE_SPCR_SPR_OFFSET )
-                      | to_underlying( spi_clock_polarity )
-                      | to_underlying( spi_clock_phase ) | to_underlying( spi_bit_order );
-        m_spi->spsr = to_underlying( spi_clock_rate ) & Peripheral::SPI::SPSR::Mask::SPI2X;
+        m_spcr = Peripheral::SPI::SPCR::Mask::MSTR
+                 | ( to_underlying( spi_clock_rate ) >> SPI_CLOCK_RATE_SPCR_SPR_OFFSET )
+                 | to_underlying( spi_clock_polarity ) | to_underlying( spi_clock_phase )
+                 | to_underlying( spi_bit_order );
+        m_spsr = to_underlying( spi_clock_rate ) & Peripheral::SPI::SPSR::Mask::SPI2X;
+
+        m_spi->spcr = m_spcr;
+        m_spi->spsr = m_spsr;
     }
 
     /**
@@ -380,8 +459,12 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
         USART_Clock_Phase    usart_clock_phase,
         USART_Bit_Order      usart_bit_order ) noexcept :
         m_usart{ &usart },
-        m_usart_xck{ Multiplexed_Signals::xck_port( usart ), Multiplexed_Signals::xck_mask( usart ) }
+        m_usart_xck{ GPIO::port_index( Multiplexed_Signals::xck_port_address(
+                         reinterpret_cast<std::uintptr_t>( &usart ) ) ),
+                     Multiplexed_Signals::xck_number( usart ) }
     {
+        Power::acquire( usart );
+
         configure_controller(
             usart_clock_generator_scaling_factor, usart_clock_polarity, usart_clock_phase, usart_bit_order );
     }
@@ -393,7 +476,9 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
      */
     constexpr Fixed_Configuration_Basic_Controller( Fixed_Configuration_Basic_Controller && source ) noexcept :
         m_usart{ source.m_usart },
-        m_usart_xck{ std::move( source.m_usart_xck ) }
+        m_ubrr{ source.m_ubrr },
+        m_usart_xck{ std::move( source.m_usart_xck ) },
+        m_transmit_complete_flag_is_valid{ source.m_transmit_complete_flag_is_valid }
     {
         source.m_usart = nullptr;
     }
@@ -421,8 +506,10 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
         if ( &expression != this ) {
             disable();
 
-            m_usart     = expression.m_usart;
-            m_usart_xck = std::move( expression.m_usart_xck );
+            m_usart                           = expression.m_usart;
+            m_ubrr                            = expression.m_ubrr;
+            m_usart_xck                       = std::move( expression.m_usart_xck );
+            m_transmit_complete_flag_is_valid = expression.m_transmit_complete_flag_is_valid;
 
             expression.m_usart = nullptr;
         } // if
@@ -469,31 +556,103 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
     {
         while ( not transmit_buffer_is_empty() ) {} // while
 
-        load_transmit_buffer( data );
+        start_transmission( data );
 
         while ( not received_data_is_available() ) {} // while
 
         return read_receive_buffer();
     }
 
+    /**
+     * \brief Transmit a block of data stored in ROM to a device.
+     *
+     * The transmit buffer is reloaded directly from ROM as soon as it is empty, and the
+     * data received from the device is discarded. Received data is discarded whenever it
+     * is available instead of being counted, since data received while the receive
+     * buffer is full (e.g. if an interrupt delays reading the receive buffer) is lost
+     * (data overrun). Once the final data has been loaded, transmission completion (TXC)
+     * is waited for and the receive buffer is flushed.
+     *
+     * \param[in] begin The beginning of the block of data stored in ROM to transmit.
+     * \param[in] end The end of the block of data stored in ROM to transmit.
+     */
+    void transmit( ROM::String begin, ROM::String end ) noexcept
+    {
+        if ( begin == end ) {
+            return;
+        } // if
+
+        auto reader = ROM::Reader{ begin };
+
+        for ( auto n = static_cast<std::size_t>( end - begin ); n; --n ) {
+            auto const data = reader.read();
+
+            while ( not transmit_buffer_is_empty() ) {} // while
+
+            start_transmission( data );
+
+            flush_receive_buffer();
+        } // for
+
+        while ( not transmission_is_complete() ) {} // while
+
+        flush_receive_buffer();
+    }
+
+    /**
+     * \brief Handle a system clock prescaler change.
+     *
+     * \param[in] previous_shift The previous clock shift.
+     * \param[in] shift The new clock shift.
+     */
+    void handle_clock_change( std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept
+    {
+        static_cast<void>( previous_shift );
+
+        m_usart->spi_host.ubrr = Clock::scale_ubrr( m_ubrr, shift );
+    }
+
   private:
     /**
      * \brief The USART used by the controller.
      */
     Peripheral::USART * m_usart{};
 
+    /**
+     * \brief The USART clock generator scaling factor (UBRR register value) the
+     *        controller was configured with (unscaled system clock).
+     */
+    std::uint16_t m_ubrr{};
+
     /**
      * \brief The USART's XCK pin.
      */
-    GPIO::Push_Pull_IO_Pin m_usart_xck{};
+    GPIO::Compact_Push_Pull_IO_Pin m_usart_xck{};
+
+    /**
+     * \brief Data has been loaded into the transmit buffer since the controller was
+     *        constructed (TXC will be set once the data has been transmitted).
+     */
+    bool m_transmit_complete_flag_is_valid{};
 
     /**
      * \brief Disable the controller.
+     *
+     * Any data that has been loaded into the transmit buffer is transmitted before the
+     * controller is disabled and the USART is powered down.
      */
     constexpr void disable() noexcept
     {
         if ( m_usart ) {
+            if ( m_transmit_complete_flag_is_valid ) {
+                while ( not transmit_buffer_is_empty() ) {} // while
+
+                while ( not transmission_is_complete() ) {} // while
+            } // if
+
             disable_controller();
+
+            Power::release( *m_usart );
         } // if
     }
 
@@ -518,6 +677,8 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
                                   | to_underlying( usart_clock_phase )
                                   | to_underlying( usart_bit_order );
         m_usart->spi_host.ubrr = usart_clock_generator_scaling_factor;
+
+        m_ubrr = usart_clock_generator_scaling_factor;
     }
 
     /**
@@ -583,6 +744,47 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
         m_usart->spi_host.udr = data;
     }
 
+    /**
+     * \brief Clear the transmit complete flag (TXC).
+     */
+    void clear_transmit_complete_flag() noexcept
+    {
+        m_usart->spi_host.ucsra = Peripheral::USART::SPI_Host::UCSRA::Mask::TXC;
+
+        m_transmit_complete_flag_is_valid = true;
+    }
+
+    /**
+     * \brief Load data into the transmit buffer and clear the transmit complete flag
+     *        (TXC).
+     *
+     * TXC is cleared immediately after the data is loaded, with interrupts disabled.
+     * Clearing TXC before loading the data would race with the completion of the previous
+     * transmission, and an interrupt between loading the data and clearing TXC could
+     * delay the clear until after the loaded data has been transmitted (clearing the only
+     * TXC that will be set).
+     *
+     * \param[in] data The data to load into the transmit buffer.
+     */
+    void start_transmission( std::uint8_t data ) noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        load_transmit_buffer( data );
+        clear_transmit_complete_flag();
+    }
+
+    /**
+     * \brief Check if transmission is complete.
+     *
+     * \return true if transmission is complete.
+     * \return false if transmission is not complete.
+     */
+    auto transmission_is_complete() const noexcept -> bool
+    {
+        return m_usart->spi_host.ucsra & Peripheral::USART::SPI_Host::UCSRA::Mask::TXC;
+    }
+
     /**
      * \brief Check if received data is available.
      *
@@ -603,6 +805,16 @@ class Fixed_Configuration_Basic_Controller<Peripheral::USART> {
     {
         return m_usart->spi_host.udr;
     }
+
+    /**
+     * \brief Discard any data in the receive buffer.
+     */
+    void flush_receive_buffer() noexcept
+    {
+        while ( received_data_is_available() ) {
+            static_cast<void>( read_receive_buffer() );
+        } // while
+    }
 };
 
 /**
@@ -756,6 +968,7 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
                         static_cast<std::uint8_t>(
                             Multiplexed_Signals::sck_mask( spi ) | Multiplexed_Signals::mosi_mask( spi ) ) }
     {
+        Power::acquire( spi );
     }
 
     /**
@@ -766,7 +979,11 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
     constexpr Variable_Configuration_Basic_Controller( Variable_Configuration_Basic_Controller && source ) noexcept
         :
         m_spi{ source.m_spi },
-        m_spi_sck_mosi{ std::move( source.m_spi_sck_mosi ) }
+        m_spi_sck_mosi{ std::move( source.m_spi_sck_mosi ) },
+        m_configuration{ source.m_configuration },
+        m_clock_shift{ source.m_clock_shift },
+        m_spcr{ source.m_spcr },
+        m_spsr{ source.m_spsr }
     {
         source.m_spi = nullptr;
     }
@@ -794,8 +1011,12 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
         if ( &expression != this ) {
             disable();
 
-            m_spi          = expression.m_spi;
-            m_spi_sck_mosi = std::move( expression.m_spi_sck_mosi );
+            m_spi           = expression.m_spi;
+            m_spi_sck_mosi  = std::move( expression.m_spi_sck_mosi );
+            m_configuration = expression.m_configuration;
+            m_clock_shift   = expression.m_clock_shift;
+            m_spcr          = expression.m_spcr;
+            m_spsr          = expression.m_spsr;
 
             expression.m_spi = nullptr;
         } // if
@@ -807,11 +1028,16 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
 
     /**
      * \brief Initialize the controller's hardware.
+     *
+     * SPCR and SPSR are rewritten, so the controller is no longer configured with the
+     * ROM configuration it was most recently configured with (if any).
      */
     void initialize() noexcept
     {
         m_spi_sck_mosi.initialize();
 
+        m_configuration = ROM::Pointer<Configuration>{};
+
         enable_controller();
     }
 
@@ -824,9 +1050,34 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
      */
     void configure( Configuration configuration ) noexcept
     {
+        m_configuration = ROM::Pointer<Configuration>{};
+
         configure_controller( configuration.spcr(), configuration.spsr() );
     }
 
+    /**
+     * \brief Configure the controller's clock and data exchange bit order to meet a
+     *        specific device's communication requirements.
+     *
+     * If the configuration is the configuration the controller was most recently
+     * configured with, the controller's registers are not rewritten.
+     *
+     * \param[in] configuration The clock and data exchange bit order configuration (stored
+     *            in ROM) that meets the device's communication requirements.
+     */
+    void configure( ROM::Pointer<Configuration> configuration ) noexcept
+    {
+        if ( configuration == m_configuration ) {
+            return;
+        } // if
+
+        m_configuration = configuration;
+
+        auto const registers = *configuration;
+
+        configure_controller( registers.spcr(), registers.spsr() );
+    }
+
     /**
      * \brief Exchange data with a device.
      *
@@ -843,6 +1094,56 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
         return finish_exchange();
     }
 
+    /**
+     * \brief Transmit a block of data stored in ROM to a device.
+     *
+     * Each byte is read from ROM while the previous byte is being transmitted, and the
+     * data received from the device is ignored.
+     *
+     * \param[in] begin The beginning of the block of data stored in ROM to transmit.
+     * \param[in] end The end of the block of data stored in ROM to transmit.
+     */
+    void transmit( ROM::String begin, ROM::String end ) noexcept
+    {
+        if ( begin == end ) {
+            return;
+        } // if
+
+        auto reader = ROM::Reader{ begin };
+
+        initiate_exchange( reader.read() );
+
+        for ( auto n = static_cast<std::size_t>( end - begin ) - 1; n; --n ) {
+            auto const data = reader.read();
+
+            while ( not exchange_complete() ) {} // while
+
+            initiate_exchange( data );
+        } // for
+
+        while ( not exchange_complete() ) {} // while
+
+        static_cast<void>( finish_exchange() );
+    }
+
+    /**
+     * \brief Handle a system clock prescaler change.
+     *
+     * The active configuration's SPI clock rate is rescaled, so the ROM configuration the
+     * controller was most recently configured with (if any) remains valid.
+     *
+     * \param[in] previous_shift The previous clock shift.
+     * \param[in] shift The new clock shift.
+     */
+    void handle_clock_change( std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept
+    {
+        static_cast<void>( previous_shift );
+
+        m_clock_shift = shift;
+
+        write_registers();
+    }
+
   private:
     /**
      * \brief The SPI used by the controller.
@@ -854,6 +1155,27 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
      */
     GPIO::Push_Pull_IO_Pin m_spi_sck_mosi{};
 
+    /**
+     * \brief The ROM configuration the controller was most recently configured with (if
+     *        any).
+     */
+    ROM::Pointer<Configuration> m_configuration{};
+
+    /**
+     * \brief The clock shift the controller's configurations are scaled by.
+     */
+    std::int_fast8_t m_clock_shift{};
+
+    /**
+     * \brief The controller's active (unscaled) SPCR register value.
+     */
+    std::uint8_t m_spcr{};
+
+    /**
+     * \brief The controller's active (unscaled) SPSR register value.
+     */
+    std::uint8_t m_spsr{};
+
     /**
      * \brief Disable the controller.
      */
@@ -861,6 +1183,8 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
     {
         if ( m_spi ) {
             disable_controller();
+
+            Power::release( *m_spi );
         } // if
     }
 
@@ -877,8 +1201,11 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
      */
     void enable_controller() noexcept
     {
-        m_spi->spsr = 0;
-        m_spi->spcr = Peripheral::SPI::SPCR::Mask::SPE | Peripheral::SPI::SPCR::Mask::MSTR;
+        m_spsr = 0;
+        m_spcr = Peripheral::SPI::SPCR::Mask::SPE | Peripheral::SPI::SPCR::Mask::MSTR;
+
+        m_spi->spsr = m_spsr;
+        m_spi->spcr = m_spcr;
     }
 
     /**
@@ -889,6 +1216,23 @@ class Variable_Configuration_Basic_Controller<Peripheral::SPI> {
      */
     void configure_controller( std::uint8_t spcr, std::uint8_t spsr ) noexcept
     {
+        m_spcr = spcr;
+        m_spsr = spsr;
+
+        write_registers();
+    }
+
+    /**
+     * \brief Write the controller's active SPCR and SPSR register values, scaled by the
+     *        clock shift, to the SPI.
+     */
+    void write_registers() noexcept
+    {
+        std::uint8_t spcr = m_spcr;
+        std::uint8_t spsr = m_spsr;
+
+        Clock::scale_spi_clock_rate( spcr, spsr, m_clock_shift );
+
         m_spi->spcr = spcr;
         m_spi->spsr = spsr;
     }
@@ -1051,8 +1395,12 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
      */
     Variable_Configuration_Basic_Controller( Peripheral::USART & usart ) noexcept :
         m_usart{ &usart },
-        m_usart_xck{ Multiplexed_Signals::xck_port( usart ), Multiplexed_Signals::xck_mask( usart ) }
+        m_usart_xck{ GPIO::port_index( Multiplexed_Signals::xck_port_address(
+                         reinterpret_cast<std::uintptr_t>( &usart ) ) ),
+                     Multiplexed_Signals::xck_number( usart ) }
     {
+        Power::acquire( usart );
+
         configure_controller();
     }
 
@@ -1064,7 +1412,11 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
     constexpr Variable_Configuration_Basic_Controller( Variable_Configuration_Basic_Controller && source ) noexcept
         :
         m_usart{ source.m_usart },
-        m_usart_xck{ std::move( source.m_usart_xck ) }
+        m_usart_xck{ std::move( source.m_usart_xck ) },
+        m_configuration{ source.m_configuration },
+        m_clock_shift{ source.m_clock_shift },
+        m_ubrr{ source.m_ubrr },
+        m_transmit_complete_flag_is_valid{ source.m_transmit_complete_flag_is_valid }
     {
         source.m_usart = nullptr;
     }
@@ -1092,8 +1444,12 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
         if ( &expression != this ) {
             disable();
 
-            m_usart     = expression.m_usart;
-            m_usart_xck = std::move( expression.m_usart_xck );
+            m_usart                           = expression.m_usart;
+            m_usart_xck                       = std::move( expression.m_usart_xck );
+            m_configuration                   = expression.m_configuration;
+            m_clock_shift                     = expression.m_clock_shift;
+            m_ubrr                            = expression.m_ubrr;
+            m_transmit_complete_flag_is_valid = expression.m_transmit_complete_flag_is_valid;
 
             expression.m_usart = nullptr;
         } // if
@@ -1122,9 +1478,34 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
      */
     void configure( Configuration const & configuration ) noexcept
     {
+        m_configuration = ROM::Pointer<Configuration>{};
+
         configure_controller( configuration.ucsrc(), configuration.ubrr() );
     }
 
+    /**
+     * \brief Configure the controller's clock and data exchange bit order to meet a
+     *        specific device's communication requirements.
+     *
+     * If the configuration is the configuration the controller was most recently
+     * configured with, the controller's registers are not rewritten.
+     *
+     * \param[in] configuration The clock and data exchange bit order configuration (stored
+     *            in ROM) that meets the device's communication requirements.
+     */
+    void configure( ROM::Pointer<Configuration> configuration ) noexcept
+    {
+        if ( configuration == m_configuration ) {
+            return;
+        } // if
+
+        m_configuration = configuration;
+
+        auto const registers = *configuration;
+
+        configure_controller( registers.ucsrc(), registers.ubrr() );
+    }
+
     /**
      * \brief Exchange data with a device.
      *
@@ -1136,13 +1517,68 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
     {
         while ( not transmit_buffer_is_empty() ) {} // while
 
-        load_transmit_buffer( data );
+        start_transmission( data );
 
         while ( not received_data_is_available() ) {} // while
 
         return read_receive_buffer();
     }
 
+    /**
+     * \brief Transmit a block of data stored in ROM to a device.
+     *
+     * The transmit buffer is reloaded directly from ROM as soon as it is empty, and the
+     * data received from the device is discarded. Received data is discarded whenever it
+     * is available instead of being counted, since data received while the receive
+     * buffer is full (e.g. if an interrupt delays reading the receive buffer) is lost
+     * (data overrun). Once the final data has been loaded, transmission completion (TXC)
+     * is waited for and the receive buffer is flushed.
+     *
+     * \param[in] begin The beginning of the block of data stored in ROM to transmit.
+     * \param[in] end The end of the block of data stored in ROM to transmit.
+     */
+    void transmit( ROM::String begin, ROM::String end ) noexcept
+    {
+        if ( begin == end ) {
+            return;
+        } // if
+
+        auto reader = ROM::Reader{ begin };
+
+        for ( auto n = static_cast<std::size_t>( end - begin ); n; --n ) {
+            auto const data = reader.read();
+
+            while ( not transmit_buffer_is_empty() ) {} // while
+
+            start_transmission( data );
+
+            flush_receive_buffer();
+        } // for
+
+        while ( not transmission_is_complete() ) {} // while
+
+        flush_receive_buffer();
+    }
+
+    /**
+     * \brief Handle a system clock prescaler change.
+     *
+     * The active configuration's UBRR register value is rescaled, so the ROM
+     * configuration the controller was most recently configured with (if any) remains
+     * valid.
+     *
+     * \param[in] previous_shift The previous clock shift.
+     * \param[in] shift The new clock shift.
+     */
+    void handle_clock_change( std::int_fast8_t previous_shift, std::int_fast8_t shift ) noexcept
+    {
+        static_cast<void>( previous_shift );
+
+        m_clock_shift = shift;
+
+        m_usart->spi_host.ubrr = Clock::scale_ubrr( m_ubrr, shift );
+    }
+
   private:
     /**
      * \brief The USART used by the controller.
@@ -1152,15 +1588,48 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
     /**
      * \brief The USART's XCK pin.
      */
-    GPIO::Push_Pull_IO_Pin m_usart_xck{};
+    GPIO::Compact_Push_Pull_IO_Pin m_usart_xck{};
+
+    /**
+     * \brief The ROM configuration the controller was most recently configured with (if
+     *        any).
+     */
+    ROM::Pointer<Configuration> m_configuration{};
+
+    /**
+     * \brief The clock shift the controller's configurations are scaled by.
+     */
+    std::int_fast8_t m_clock_shift{};
+
+    /**
+     * \brief The controller's active (unscaled) UBRR register value.
+     */
+    std::uint16_t m_ubrr{};
+
+    /**
+     * \brief Data has been loaded into the transmit buffer since the controller was
+     *        constructed (TXC will be set once the data has been transmitted).
+     */
+    bool m_transmit_complete_flag_is_valid{};
 
     /**
      * \brief Disable the controller.
+     *
+     * Any data that has been loaded into the transmit buffer is transmitted before the
+     * controller is disabled and the USART is powered down.
      */
     constexpr void disable() noexcept
     {
         if ( m_usart ) {
+            if ( m_transmit_complete_flag_is_valid ) {
+                while ( not transmit_buffer_is_empty() ) {} // while
+
+                while ( not transmission_is_complete() ) {} // while
+            } // if
+
             disable_controller();
+
+            Power::release( *m_usart );
         } // if
     }
 
@@ -1170,8 +1639,10 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
     void configure_controller() noexcept
     {
         m_usart->spi_host.ucsrb = 0;
+        m_ubrr = 0;
+
         m_usart->spi_host.ucsrc = Peripheral::USART::SPI_Host::UCSRC::UMSEL_HOST_SPI;
-        m_usart->spi_host.ubrr  = 0;
+        m_usart->spi_host.ubrr  = Clock::scale_ubrr( m_ubrr, m_clock_shift );
     }
 
     /**
@@ -1199,8 +1670,10 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
      */
     void configure_controller( std::uint8_t ucsrc, std::uint16_t ubrr ) noexcept
     {
+        m_ubrr = ubrr;
+
         m_usart->spi_host.ucsrc = ucsrc;
-        m_usart->spi_host.ubrr  = ubrr;
+        m_usart->spi_host.ubrr  = Clock::scale_ubrr( ubrr, m_clock_shift );
     }
 
     /**
@@ -1224,6 +1697,47 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
         m_usart->spi_host.udr = data;
     }
 
+    /**
+     * \brief Clear the transmit complete flag (TXC).
+     */
+    void clear_transmit_complete_flag() noexcept
+    {
+        m_usart->spi_host.ucsra = Peripheral::USART::SPI_Host::UCSRA::Mask::TXC;
+
+        m_transmit_complete_flag_is_valid = true;
+    }
+
+    /**
+     * \brief Load data into the transmit buffer and clear the transmit complete flag
+     *        (TXC).
+     *
+     * TXC is cleared immediately after the data is loaded, with interrupts disabled.
+     * Clearing TXC before loading the data would race with the completion of the previous
+     * transmission, and an interrupt between loading the data and clearing TXC could
+     * delay the clear until after the loaded data has been transmitted (clearing the only
+     * TXC that will be set).
+     *
+     * \param[in] data The data to load into the transmit buffer.
+     */
+    void start_transmission( std::uint8_t data ) noexcept
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        load_transmit_buffer( data );
+        clear_transmit_complete_flag();
+    }
+
+    /**
+     * \brief Check if transmission is complete.
+     *
+     * \return true if transmission is complete.
+     * \return false if transmission is not complete.
+     */
+    auto transmission_is_complete() const noexcept -> bool
+    {
+        return m_usart->spi_host.ucsra & Peripheral::USART::SPI_Host::UCSRA::Mask::TXC;
+    }
+
     /**
      * \brief Check if received data is available.
      *
@@ -1244,6 +1758,16 @@ class Variable_Configuration_Basic_Controller<Peripheral::USART> {
     {
         return m_usart->spi_host.udr;
     }
+
+    /**
+     * \brief Discard any data in the receive buffer.
+     */
+    void flush_receive_buffer() noexcept
+    {
+        while ( received_data_is_available() ) {
+            static_cast<void>( read_receive_buffer() );
+        } // while
+    }
 };
 
 } // namespace picolibrary::Microchip::megaAVR::SPI
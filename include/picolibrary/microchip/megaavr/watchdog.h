@@ -0,0 +1,413 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Watchdog interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_MEGAAVR_WATCHDOG_H
+#define PICOLIBRARY_MICROCHIP_MEGAAVR_WATCHDOG_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+#include "picolibrary/microchip/megaavr/peripheral/sysctrl.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Microchip megaAVR watchdog timer facilities.
+ */
+namespace picolibrary::Microchip::megaAVR::Watchdog {
+
+/**
+ * \brief Watchdog timer mode.
+ */
+enum class Mode : std::uint8_t {
+    INTERRUPT                   = Peripheral::SYSCTRL::WDTCSR::Mask::WDIE, ///< Interrupt.
+    SYSTEM_RESET                = Peripheral::SYSCTRL::WDTCSR::Mask::WDE,  ///< System reset.
+    INTERRUPT_THEN_SYSTEM_RESET = Peripheral::SYSCTRL::WDTCSR::Mask::WDIE
+                                  | Peripheral::SYSCTRL::WDTCSR::Mask::WDE, ///< Interrupt, then system reset.
+};
+
+/**
+ * \brief Watchdog timer timeout (nominal, the watchdog oscillator runs at approximately
+ *        128 kHz).
+ */
+enum class Timeout : std::uint8_t {
+    TIMEOUT_16_MS  = 0b000 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 16 ms.
+    TIMEOUT_32_MS  = 0b001 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 32 ms.
+    TIMEOUT_64_MS  = 0b010 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 64 ms.
+    TIMEOUT_125_MS = 0b011 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 125 ms.
+    TIMEOUT_250_MS = 0b100 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 250 ms.
+    TIMEOUT_500_MS = 0b101 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 500 ms.
+    TIMEOUT_1_S    = 0b110 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 1 s.
+    TIMEOUT_2_S    = 0b111 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP, ///< 2 s.
+    TIMEOUT_4_S    = Peripheral::SYSCTRL::WDTCSR::Mask::WDP3 | ( 0b000 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP ), ///< 4 s.
+    TIMEOUT_8_S    = Peripheral::SYSCTRL::WDTCSR::Mask::WDP3 | ( 0b001 << Peripheral::SYSCTRL::WDTCSR::Bit::WDP ), ///< 8 s.
+};
+
+/**
+ * \brief Reset the watchdog timer.
+ */
+inline void reset_timer() noexcept
+{
+    asm volatile( "wdr" ::: "memory" );
+}
+
+/**
+ * \brief Write the watchdog timer configuration using the timed WDCE sequence.
+ *
+ * \attention Interrupts must be disabled when this function is called.
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ * \param[in] wdtcsr The WDTCSR value to write.
+ */
+inline void write_configuration( Peripheral::SYSCTRL & sysctrl, std::uint8_t wdtcsr ) noexcept
+{
+    reset_timer();
+
+    // the configuration must be written no more than 4 clock cycles after WDCE is set
+    asm volatile(
+        "st %a[wdtcsr], %[wdce]\n\t"
+        "st %a[wdtcsr], %[configuration]"
+        :
+        : [wdtcsr] "e"( &sysctrl.wdtcsr ),
+          [wdce] "r"( static_cast<std::uint8_t>(
+              Peripheral::SYSCTRL::WDTCSR::Mask::WDCE | Peripheral::SYSCTRL::WDTCSR::Mask::WDE ) ),
+          [configuration] "r"( wdtcsr )
+        : "memory" );
+}
+
+/**
+ * \brief Enable the watchdog timer.
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ * \param[in] mode The watchdog timer mode.
+ * \param[in] timeout The watchdog timer timeout.
+ */
+inline void enable( Peripheral::SYSCTRL & sysctrl, Mode mode, Timeout timeout ) noexcept
+{
+    auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+    write_configuration( sysctrl, to_underlying( mode ) | to_underlying( timeout ) );
+}
+
+/**
+ * \brief Disable the watchdog timer.
+ *
+ * WDRF is cleared first since it overrides WDE. After a watchdog system reset, the
+ * watchdog timer remains enabled with the shortest timeout, so this should be done early
+ * during startup.
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ * \param[in] cpu The CPU peripheral.
+ */
+inline void disable( Peripheral::SYSCTRL & sysctrl, Peripheral::CPU & cpu ) noexcept
+{
+    auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+    cpu.mcusr &= ~Peripheral::CPU::MCUSR::Mask::WDRF;
+
+    write_configuration( sysctrl, 0 );
+}
+
+/**
+ * \brief Save and clear the reset cause (MCUSR), and disable the watchdog timer.
+ *
+ * After a watchdog system reset, WDRF forces the watchdog timer on with the shortest
+ * timeout (16 ms), which can expire before `.bss` is cleared and static objects are
+ * constructed. This function is intended to be called from an early startup hook (a
+ * `.init3` function). The saved reset cause can be retrieved using
+ * picolibrary::Microchip::megaAVR::Watchdog::consume_reset_cause().
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ * \param[in] cpu The CPU peripheral.
+ */
+void save_reset_cause_and_disable( Peripheral::SYSCTRL & sysctrl, Peripheral::CPU & cpu ) noexcept;
+
+/**
+ * \brief Get and clear the reset cause.
+ *
+ * \param[in] cpu The CPU peripheral.
+ *
+ * \return The reset cause saved by
+ *         picolibrary::Microchip::megaAVR::Watchdog::save_reset_cause_and_disable() if
+ *         it has been saved since the most recent reset and not yet consumed.
+ * \return The MCUSR value (MCUSR is cleared) if the reset cause has not been saved since
+ *         the most recent reset.
+ */
+auto consume_reset_cause( Peripheral::CPU & cpu ) noexcept -> std::uint8_t;
+
+/**
+ * \brief Reset the system using the watchdog timer.
+ *
+ * Interrupts are disabled and the watchdog timer is configured for a system reset after
+ * the shortest timeout (16 ms).
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ */
+[[noreturn]] inline void reset_system( Peripheral::SYSCTRL & sysctrl ) noexcept
+{
+    Interrupt::Controller{}.disable_interrupt();
+
+    write_configuration( sysctrl, to_underlying( Mode::SYSTEM_RESET ) | to_underlying( Timeout::TIMEOUT_16_MS ) );
+
+    for ( ;; ) {} // for
+}
+
+class Monitor;
+
+/**
+ * \brief Liveness monitor task.
+ *
+ * \attention Tasks are linked into a monitor's task list in place. A task must therefore
+ *            be removed from the monitor before it is destroyed.
+ */
+class Task {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Task() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] id The task's ID (reported when the task fails to check in).
+     */
+    constexpr Task( std::uint8_t id ) noexcept : m_id{ id }
+    {
+    }
+
+    Task( Task && ) = delete;
+
+    Task( Task const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Task() noexcept = default;
+
+    auto operator=( Task && ) = delete;
+
+    auto operator=( Task const & ) = delete;
+
+    /**
+     * \brief Get the task's ID.
+     *
+     * \return The task's ID.
+     */
+    constexpr auto id() const noexcept -> std::uint8_t
+    {
+        return m_id;
+    }
+
+    /**
+     * \brief Report that the task is alive.
+     */
+    void check_in() noexcept
+    {
+        m_has_checked_in = true;
+    }
+
+  private:
+    friend class Monitor;
+
+    /**
+     * \brief The next task in the monitor's task list.
+     */
+    Task * m_next{};
+
+    /**
+     * \brief The task's ID.
+     */
+    std::uint8_t m_id{};
+
+    /**
+     * \brief The task's check in flag.
+     */
+    bool volatile m_has_checked_in{};
+};
+
+/**
+ * \brief Watchdog liveness monitor.
+ *
+ * The monitor only resets the watchdog timer once every task has checked in since the
+ * previous watchdog timer reset, so a single hung task causes a watchdog timeout even if
+ * the main loop keeps running.
+ */
+class Monitor {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Monitor() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] sysctrl The SYSCTRL peripheral.
+     * \param[in] cpu The CPU peripheral.
+     */
+    constexpr Monitor( Peripheral::SYSCTRL & sysctrl, Peripheral::CPU & cpu ) noexcept :
+        m_sysctrl{ &sysctrl },
+        m_cpu{ &cpu }
+    {
+    }
+
+    Monitor( Monitor && ) = delete;
+
+    Monitor( Monitor const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Monitor() noexcept
+    {
+        if ( m_sysctrl ) {
+            Watchdog::disable( *m_sysctrl, *m_cpu );
+        } // if
+    }
+
+    auto operator=( Monitor && ) = delete;
+
+    auto operator=( Monitor const & ) = delete;
+
+    /**
+     * \brief Enable the watchdog timer.
+     *
+     * \param[in] mode The watchdog timer mode.
+     * \param[in] timeout The watchdog timer timeout.
+     */
+    void enable( Mode mode, Timeout timeout ) noexcept
+    {
+        Watchdog::enable( *m_sysctrl, mode, timeout );
+    }
+
+    /**
+     * \brief Disable the watchdog timer.
+     */
+    void disable() noexcept
+    {
+        Watchdog::disable( *m_sysctrl, *m_cpu );
+    }
+
+    /**
+     * \brief Add a task to the monitor.
+     *
+     * \param[in] task The task to add.
+     */
+    void add( Task & task ) noexcept
+    {
+        task.m_has_checked_in = true;
+
+        task.m_next = m_tasks;
+        m_tasks     = &task;
+    }
+
+    /**
+     * \brief Remove a task from the monitor.
+     *
+     * \param[in] task The task to remove.
+     */
+    void remove( Task & task ) noexcept
+    {
+        for ( auto link = &m_tasks; *link; link = &( *link )->m_next ) {
+            if ( *link == &task ) {
+                *link = task.m_next;
+
+                return;
+            } // if
+        } // for
+    }
+
+    /**
+     * \brief Reset the watchdog timer if every task has checked in since the previous
+     *        watchdog timer reset.
+     *
+     * The check, the watchdog timer reset, and the clearing of the tasks' check in flags
+     * are performed with interrupts disabled, so a task that checks in from an interrupt
+     * service routine cannot have its check in cleared without it being counted.
+     *
+     * \attention This function should be called from the main loop.
+     *
+     * \return true if the watchdog timer was reset.
+     * \return false if one or more tasks have not checked in.
+     */
+    auto service() noexcept -> bool
+    {
+        auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+        if ( unresponsive_task() ) {
+            return false;
+        } // if
+
+        reset_timer();
+
+        for ( auto task = m_tasks; task; task = task->m_next ) {
+            task->m_has_checked_in = false;
+        } // for
+
+        return true;
+    }
+
+    /**
+     * \brief Get the first task that has not checked in since the previous watchdog timer
+     *        reset.
+     *
+     * This is intended to be reported by the watchdog timer interrupt service routine
+     * (last words) in picolibrary::Microchip::megaAVR::Watchdog::Mode::INTERRUPT_THEN_SYSTEM_RESET
+     * mode.
+     *
+     * \return The first task that has not checked in since the previous watchdog timer
+     *         reset.
+     * \return nullptr if every task has checked in since the previous watchdog timer
+     *         reset.
+     */
+    auto unresponsive_task() const noexcept -> Task const *
+    {
+        for ( auto task = m_tasks; task; task = task->m_next ) {
+            if ( not task->m_has_checked_in ) {
+                return task;
+            } // if
+        } // for
+
+        return nullptr;
+    }
+
+  private:
+    /**
+     * \brief The SYSCTRL peripheral.
+     */
+    Peripheral::SYSCTRL * m_sysctrl{};
+
+    /**
+     * \brief The CPU peripheral.
+     */
+    Peripheral::CPU * m_cpu{};
+
+    /**
+     * \brief The task list.
+     */
+    Task * m_tasks{};
+};
+
+} // namespace picolibrary::Microchip::megaAVR::Watchdog
+
+#endif // PICOLIBRARY_MICROCHIP_MEGAAVR_WATCHDOG_H
@@ -27,6 +27,7 @@
 
 #include "picolibrary/algorithm.h"
 #include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/crash_record.h"
 #include "picolibrary/microchip/megaavr/peripheral.h"
 #include "picolibrary/microchip/megaavr/peripheral/usart.h"
 #include "picolibrary/precondition.h"
@@ -63,6 +64,9 @@ class Log : public Reliable_Output_Stream {
     /**
      * \brief Initialize the log.
      *
+     * If a crash record was captured before the most recent reset, it is recovered (which
+     * also consumes the reset cause) and reported.
+     *
      * \pre not picolibrary::Testing::Interactive::Microchip::megaAVR::Log::is_initialized()
      *
      * \param[in] usart The USART peripheral to be used by the log.
@@ -90,6 +94,12 @@ class Log : public Reliable_Output_Stream {
         usart.normal.ucsrb |= ::picolibrary::Microchip::megaAVR::Peripheral::USART::Normal::UCSRB::Mask::TXEN;
 
         USART = &usart;
+
+        auto record = ::picolibrary::Microchip::megaAVR::Crash_Record::Record{};
+        if ( ::picolibrary::Microchip::megaAVR::Crash_Record::recover(
+                 ::picolibrary::Microchip::megaAVR::Peripheral::CPU0::instance(), record ) ) {
+            report_crash_record( record );
+        } // if
     }
 
 #if defined( PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR_LOG_USART )                                    \
@@ -98,6 +108,9 @@ class Log : public Reliable_Output_Stream {
     /**
      * \brief Initialize the log.
      *
+     * If a crash record was captured before the most recent reset, it is recovered (which
+     * also consumes the reset cause) and reported.
+     *
      * \pre not picolibrary::Testing::Interactive::Microchip::megaAVR::Log::is_initialized()
      */
     static void initialize() noexcept
@@ -127,6 +140,35 @@ class Log : public Reliable_Output_Stream {
         } // if
     }
 
+    /**
+     * \brief Report a crash record.
+     *
+     * The return address is reported as a word address (multiply it by 2 to get the byte
+     * address used by tools such as avr-objdump and avr-addr2line).
+     *
+     * \param[in] record The crash record.
+     */
+    static void report_crash_record( ::picolibrary::Microchip::megaAVR::Crash_Record::Record const & record ) noexcept
+    {
+        if ( is_initialized() ) {
+            transmit( PICOLIBRARY_ROM_STRING( "crash record: category " ) );
+            transmit_hexadecimal( record.category_id, 4 );
+            transmit( PICOLIBRARY_ROM_STRING( ", error " ) );
+            transmit_hexadecimal( record.description_id, 2 );
+            transmit( PICOLIBRARY_ROM_STRING( ", return address " ) );
+#if defined( __AVR_ATmega2560__ )
+            transmit_hexadecimal( record.return_address, 6 );
+#else  // defined( __AVR_ATmega2560__ )
+            transmit_hexadecimal( record.return_address, 4 );
+#endif // defined( __AVR_ATmega2560__ )
+            transmit( PICOLIBRARY_ROM_STRING( ", stack pointer " ) );
+            transmit_hexadecimal( record.stack_pointer, 4 );
+            transmit( PICOLIBRARY_ROM_STRING( ", MCUSR " ) );
+            transmit_hexadecimal( record.mcusr, 2 );
+            transmit( '\n' );
+        } // if
+    }
+
     /**
      * \brief Get the log instance.
      *
@@ -308,7 +350,24 @@ class Log : public Reliable_Output_Stream {
      */
     static void transmit( ROM::String string ) noexcept
     {
-        while ( auto const character = *string++ ) { transmit( character ); } // while
+        ROM::for_each( string, []( auto character ) noexcept { transmit( character ); } );
+    }
+
+    /**
+     * \brief Transmit an unsigned integer in hexadecimal (0x prefixed).
+     *
+     * \param[in] value The unsigned integer to transmit.
+     * \param[in] digits The number of digits to transmit.
+     */
+    static void transmit_hexadecimal( std::uint32_t value, std::uint_fast8_t digits ) noexcept
+    {
+        transmit( PICOLIBRARY_ROM_STRING( "0x" ) );
+
+        while ( digits-- ) {
+            auto const nibble = static_cast<std::uint8_t>( ( value >> ( digits * 4 ) ) & 0xF );
+
+            transmit( static_cast<std::uint8_t>( nibble < 10 ? '0' + nibble : 'A' + nibble - 10 ) );
+        } // while
     }
 
     /**
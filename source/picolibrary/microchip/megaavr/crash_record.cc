@@ -0,0 +1,117 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Crash_Record implementation.
+ */
+
+#include "picolibrary/microchip/megaavr/crash_record.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+#include "picolibrary/microchip/megaavr/watchdog.h"
+
+namespace picolibrary::Microchip::megaAVR::Crash_Record {
+
+namespace {
+
+/**
+ * \brief The stored crash record signature.
+ */
+constexpr auto SIGNATURE = std::uint16_t{ 0xC4A5 };
+
+/**
+ * \brief Stored crash record.
+ */
+struct Stored_Record {
+    /**
+     * \brief The stored crash record signature (SIGNATURE if the stored crash record is
+     *        valid).
+     */
+    std::uint16_t signature;
+
+    /**
+     * \brief The crash record.
+     */
+    Record record;
+
+    /**
+     * \brief The crash record's checksum.
+     */
+    std::uint16_t checksum;
+};
+
+/**
+ * \brief The stored crash record.
+ */
+Stored_Record stored_record __attribute__( ( section( ".noinit" ) ) );
+
+/**
+ * \brief Compute a crash record's checksum (Fletcher-16).
+ *
+ * \param[in] record The crash record whose checksum is to be computed.
+ *
+ * \return The crash record's checksum.
+ */
+auto checksum( Record const & record ) noexcept -> std::uint16_t
+{
+    auto const data = reinterpret_cast<std::uint8_t const *>( &record );
+
+    auto sum_a = std::uint16_t{ 0 };
+    auto sum_b = std::uint16_t{ 0 };
+    for ( auto i = std::uint_fast8_t{ 0 }; i < sizeof( Record ); ++i ) {
+        sum_a = ( sum_a + data[ i ] ) % 255;
+        sum_b = ( sum_b + sum_a ) % 255;
+    } // for
+
+    return ( sum_b << 8 ) | sum_a;
+}
+
+} // namespace
+
+void capture( Peripheral::CPU & cpu, Error_Code const & error, Return_Address return_address ) noexcept
+{
+    stored_record.signature = 0;
+
+    stored_record.record.category_id    = reinterpret_cast<std::uintptr_t>( &error.category() );
+    stored_record.record.description_id = error.error();
+    stored_record.record.return_address = return_address;
+    stored_record.record.stack_pointer  = cpu.sp;
+    stored_record.record.mcusr          = 0;
+
+    stored_record.checksum  = checksum( stored_record.record );
+    stored_record.signature = SIGNATURE;
+}
+
+auto recover( Peripheral::CPU & cpu, Record & record ) noexcept -> bool
+{
+    auto const is_valid = stored_record.signature == SIGNATURE
+                          and stored_record.checksum == checksum( stored_record.record );
+
+    record = is_valid ? stored_record.record : Record{};
+
+    record.mcusr = Watchdog::consume_reset_cause( cpu );
+
+    stored_record.signature = 0;
+
+    return is_valid;
+}
+
+} // namespace picolibrary::Microchip::megaAVR::Crash_Record
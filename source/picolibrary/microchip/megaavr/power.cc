@@ -0,0 +1,137 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Power implementation.
+ */
+
+#include "picolibrary/microchip/megaavr/power.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/interrupt.h"
+#include "picolibrary/microchip/megaavr/peripheral.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/register.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Microchip::megaAVR::Power {
+
+namespace {
+
+/**
+ * \brief The number of power reduction registers.
+ */
+#if defined( __AVR_ATmega328P__ )
+constexpr auto POWER_REDUCTION_REGISTERS = std::uint_fast8_t{ 1 };
+#elif defined( __AVR_ATmega2560__ )
+constexpr auto POWER_REDUCTION_REGISTERS = std::uint_fast8_t{ 2 };
+#endif // defined( __AVR_ATmega2560__ )
+
+/**
+ * \brief The number of references to each module.
+ */
+std::uint8_t reference_counts[ POWER_REDUCTION_REGISTERS * 8 ];
+
+/**
+ * \brief Get a module's power reduction register.
+ *
+ * \param[in] module The module whose power reduction register is to be gotten.
+ *
+ * \return The module's power reduction register.
+ */
+auto power_reduction_register( std::uint_fast8_t module ) noexcept -> Register<std::uint8_t> &
+{
+    auto & sysctrl = Peripheral::SYSCTRL0::instance();
+
+    if ( module >> 3 ) {
+        return sysctrl.prr1;
+    } // if
+
+    return sysctrl.prr0;
+}
+
+/**
+ * \brief Get a module's power reduction register mask.
+ *
+ * \param[in] module The module whose power reduction register mask is to be gotten.
+ *
+ * \return The module's power reduction register mask.
+ */
+constexpr auto power_reduction_mask( std::uint_fast8_t module ) noexcept -> std::uint8_t
+{
+    return 1 << ( module & 0b111 );
+}
+
+/**
+ * \brief Check if a power reduction register bit controls a module.
+ *
+ * \param[in] module The power reduction register bit to check.
+ *
+ * \return true if the power reduction register bit controls a module.
+ * \return false if the power reduction register bit is reserved.
+ */
+constexpr auto is_module( std::uint_fast8_t module ) noexcept -> bool
+{
+    auto const reserved_mask = module >> 3 ? Peripheral::SYSCTRL::PRR1::Mask::RESERVED6
+                                           : Peripheral::SYSCTRL::PRR0::Mask::RESERVED4;
+
+    return not( reserved_mask & power_reduction_mask( module ) );
+}
+
+} // namespace
+
+void acquire( Module module ) noexcept
+{
+    auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+    auto & reference_count = reference_counts[ to_underlying( module ) ];
+
+    if ( reference_count++ == 0 ) {
+        power_reduction_register( to_underlying( module ) ) &= ~power_reduction_mask(
+            to_underlying( module ) );
+    } // if
+}
+
+void release( Module module ) noexcept
+{
+    auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+    auto & reference_count = reference_counts[ to_underlying( module ) ];
+
+    PICOLIBRARY_EXPECT( reference_count != 0, Generic_Error::WOULD_UNDERFLOW );
+
+    if ( --reference_count == 0 ) {
+        power_reduction_register( to_underlying( module ) ) |= power_reduction_mask(
+            to_underlying( module ) );
+    } // if
+}
+
+void power_down_unreferenced_modules() noexcept
+{
+    auto const critical_section = Interrupt::Critical_Section{ Interrupt::MAIN_CONTEXT };
+
+    for ( auto module = std::uint_fast8_t{}; module < sizeof( reference_counts ); ++module ) {
+        if ( is_module( module ) and not reference_counts[ module ] ) {
+            power_reduction_register( module ) |= power_reduction_mask( module );
+        } // if
+    } // for
+}
+
+} // namespace picolibrary::Microchip::megaAVR::Power
@@ -0,0 +1,88 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::Watchdog implementation.
+ */
+
+#include "picolibrary/microchip/megaavr/watchdog.h"
+
+#include <cstdint>
+
+#include "picolibrary/microchip/megaavr/peripheral/cpu.h"
+#include "picolibrary/microchip/megaavr/peripheral/sysctrl.h"
+
+namespace picolibrary::Microchip::megaAVR::Watchdog {
+
+namespace {
+
+/**
+ * \brief The saved reset cause signature.
+ */
+constexpr auto SIGNATURE = std::uint16_t{ 0x5A3C };
+
+/**
+ * \brief Saved reset cause.
+ */
+struct Saved_Reset_Cause {
+    /**
+     * \brief The saved reset cause signature (SIGNATURE if the saved reset cause is
+     *        valid).
+     */
+    std::uint16_t signature;
+
+    /**
+     * \brief The saved MCUSR value.
+     */
+    std::uint8_t mcusr;
+};
+
+/**
+ * \brief The saved reset cause (in `.noinit` since it is saved before `.bss` is
+ *        cleared).
+ */
+Saved_Reset_Cause saved_reset_cause __attribute__( ( section( ".noinit" ) ) );
+
+} // namespace
+
+void save_reset_cause_and_disable( Peripheral::SYSCTRL & sysctrl, Peripheral::CPU & cpu ) noexcept
+{
+    saved_reset_cause.mcusr     = cpu.mcusr;
+    saved_reset_cause.signature = SIGNATURE;
+
+    disable( sysctrl, cpu );
+
+    cpu.mcusr = 0;
+}
+
+auto consume_reset_cause( Peripheral::CPU & cpu ) noexcept -> std::uint8_t
+{
+    if ( saved_reset_cause.signature == SIGNATURE ) {
+        saved_reset_cause.signature = 0;
+
+        return saved_reset_cause.mcusr;
+    } // if
+
+    auto const mcusr = std::uint8_t{ cpu.mcusr };
+
+    cpu.mcusr = 0;
+
+    return mcusr;
+}
+
+} // namespace picolibrary::Microchip::megaAVR::Watchdog
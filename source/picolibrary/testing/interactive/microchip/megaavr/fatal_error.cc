@@ -22,18 +22,100 @@
 
 #include "picolibrary/fatal_error.h"
 
+#include <cstdint>
 #include <cstdlib>
 
 #include "picolibrary/error.h"
+#include "picolibrary/microchip/megaavr/crash_record.h"
+#include "picolibrary/microchip/megaavr/peripheral.h"
+#include "picolibrary/microchip/megaavr/watchdog.h"
 #include "picolibrary/testing/interactive/microchip/megaavr/log.h"
 
-namespace picolibrary {
+#if defined( PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR_FATAL_ERROR_WATCHDOG_RESET )
+namespace {
 
-void trap_fatal_error( Error_Code const & error ) noexcept
+/**
+ * \brief Save and clear the reset cause, and disable the watchdog timer during startup.
+ *
+ * After the watchdog system reset performed by picolibrary::trap_fatal_error(), WDRF
+ * forces the watchdog timer on with a 16 ms timeout, which would reset the system again
+ * before main() could disable it. This function is placed in `.init3` so that it runs
+ * after the stack pointer and zero register have been initialized, but before `.bss` is
+ * cleared and static objects are constructed.
+ */
+__attribute__( ( naked, used, section( ".init3" ) ) ) void disable_watchdog() noexcept
+{
+    ::picolibrary::Microchip::megaAVR::Watchdog::save_reset_cause_and_disable(
+        ::picolibrary::Microchip::megaAVR::Peripheral::SYSCTRL0::instance(),
+        ::picolibrary::Microchip::megaAVR::Peripheral::CPU0::instance() );
+}
+
+} // namespace
+#endif // defined( PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR_FATAL_ERROR_WATCHDOG_RESET )
+
+namespace {
+
+/**
+ * \brief Capture a crash record, report a fatal error, and halt (or reset the system).
+ *
+ * \param[in] error The fatal error.
+ * \param[in] return_address The return address of picolibrary::trap_fatal_error() (a
+ *            word address).
+ */
+[[noreturn]] void handle_fatal_error(
+    ::picolibrary::Error_Code const &                               error,
+    ::picolibrary::Microchip::megaAVR::Crash_Record::Return_Address return_address ) noexcept
 {
-    Testing::Interactive::Microchip::megaAVR::Log::report_fatal_error( error );
+    ::picolibrary::Microchip::megaAVR::Crash_Record::capture(
+        ::picolibrary::Microchip::megaAVR::Peripheral::CPU0::instance(), error, return_address );
+
+    ::picolibrary::Testing::Interactive::Microchip::megaAVR::Log::report_fatal_error( error );
 
+#if defined( PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR_FATAL_ERROR_WATCHDOG_RESET )
+    ::picolibrary::Microchip::megaAVR::Watchdog::reset_system(
+        ::picolibrary::Microchip::megaAVR::Peripheral::SYSCTRL0::instance() );
+#else  // defined( PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR_FATAL_ERROR_WATCHDOG_RESET )
     std::abort();
+#endif // defined( PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MEGAAVR_FATAL_ERROR_WATCHDOG_RESET )
+}
+
+} // namespace
+
+namespace picolibrary {
+
+#if defined( __AVR_ATmega2560__ )
+/**
+ * \brief Trap a fatal error.
+ *
+ * The ATmega2560 has a 3 byte program counter, but `__builtin_return_address( 0 )` only
+ * provides its 2 least significant bytes. This function therefore reads the complete
+ * return address from the stack before its frame is set up, and then jumps to
+ * handle_fatal_error() (the error is passed through unchanged in R25:R24, and the
+ * return address is passed in R23:R20).
+ */
+__attribute__( ( naked ) ) void trap_fatal_error( Error_Code const & ) noexcept
+{
+    asm volatile(
+        "in r30, __SP_L__\n\t"
+        "in r31, __SP_H__\n\t"
+        "ldd r22, Z+1\n\t"
+        "ldd r21, Z+2\n\t"
+        "ldd r20, Z+3\n\t"
+        "clr r23\n\t"
+        "jmp %x[handle_fatal_error]"
+        :
+        : [handle_fatal_error] "i"( &handle_fatal_error ) );
+
+    __builtin_unreachable();
+}
+#else  // defined( __AVR_ATmega2560__ )
+void trap_fatal_error( Error_Code const & error ) noexcept
+{
+    handle_fatal_error(
+        error,
+        static_cast<Microchip::megaAVR::Crash_Record::Return_Address>(
+            reinterpret_cast<std::uintptr_t>( __builtin_return_address( 0 ) ) ) );
 }
+#endif // defined( __AVR_ATmega2560__ )
 
 } // namespace picolibrary
@@ -0,0 +1,62 @@
+/**
+ * picolibrary-microchip-megaavr
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-megaavr contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::megaAVR::ADC::Blocking_Single_Sample_Converter sample
+ *        interactive test program.
+ */
+
+#include <avr-libcpp/delay>
+
+#include "picolibrary/microchip/megaavr/adc.h"
+#include "picolibrary/microchip/megaavr/peripheral.h"
+#include "picolibrary/testing/interactive/adc.h"
+#include "picolibrary/testing/interactive/microchip/megaavr/log.h"
+
+namespace {
+
+using ::picolibrary::Microchip::megaAVR::ADC::ADC_Input;
+using ::picolibrary::Microchip::megaAVR::ADC::ADC_Voltage_Reference;
+using ::picolibrary::Microchip::megaAVR::ADC::Blocking_Single_Sample_Converter;
+using ::picolibrary::Testing::Interactive::ADC::sample;
+using ::picolibrary::Testing::Interactive::Microchip::megaAVR::Log;
+
+using namespace ::picolibrary::Microchip::megaAVR::Peripheral;
+
+} // namespace
+
+/**
+ * \brief Execute the
+ *        picolibrary::Microchip::megaAVR::ADC::Blocking_Single_Sample_Converter sample
+ *        interactive test.
+ *
+ * \return N/A
+ */
+int main() noexcept
+{
+    Log::initialize();
+
+    sample(
+        Log::instance(),
+        Blocking_Single_Sample_Converter{ CONVERTER_ADC::instance(),
+                                          ADC_Voltage_Reference::ADC_VOLTAGE_REFERENCE,
+                                          ADC_Input::ADC_INPUT },
+        []() { avrlibcpp::delay_ms( 1000 ); } );
+
+    for ( ;; ) {} // for
+}